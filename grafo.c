@@ -0,0 +1,187 @@
+#include <stdlib.h>
+#include <string.h>
+#include "grafo.h"
+#include "semantico.h"
+
+typedef struct {
+    int destino;
+    int chamadas;
+} TAresta;
+
+typedef struct {
+    const char *nome;       /* lexema internado */
+    int linha;
+    long atomos;            /* tamanho do corpo (begin ... end) */
+    int chamadas;           /* sítios de chamada recebidos */
+    int chamadas_em_laco;
+    TAresta *arestas;
+    int num_arestas;
+    int alcancavel;
+    int componente;         /* componente fortemente conexa (Tarjan) */
+    int recursiva;
+    /* estado do Tarjan */
+    int indice, menor, na_pilha;
+} TNo;
+
+static TNo *nos = NULL;
+static int num_nos = 0;
+
+static int criar_no(const char *nome, int linha) {
+    if ((num_nos & (num_nos - 1)) == 0) {   /* capacidade dobra nas potências de 2 */
+        nos = sem_alocar(nos, (size_t)(num_nos ? 2 * num_nos : 1) * sizeof(TNo));
+    }
+    TNo *n = &nos[num_nos];
+    memset(n, 0, sizeof(TNo));
+    n->nome = nome;
+    n->linha = linha;
+    n->indice = -1;
+    return num_nos++;
+}
+
+void grafo_iniciar(void) {
+    criar_no("(programa principal)", 0);
+}
+
+int grafo_nova_subrotina(const char *nome, int linha) {
+    return criar_no(nome, linha);
+}
+
+void grafo_definir_tamanho(int id, long atomos) {
+    nos[id].atomos = atomos;
+}
+
+void grafo_anotar_chamada(TChamadas *buf, int destino, int em_laco) {
+    if (buf->qtd == buf->capacidade) {
+        buf->capacidade = buf->capacidade ? 2 * buf->capacidade : 8;
+        buf->itens = sem_alocar(buf->itens, (size_t)buf->capacidade * sizeof(TChamada));
+    }
+    buf->itens[buf->qtd].destino = destino;
+    buf->itens[buf->qtd].em_laco = em_laco;
+    buf->qtd++;
+}
+
+static int comparar_chamadas(const void *a, const void *b) {
+    const TChamada *x = a, *y = b;
+    return (x->destino > y->destino) - (x->destino < y->destino);
+}
+
+/* ordenadas pelo destino, as chamadas repetidas viram uma aresta com contagem,
+   e as arestas saem na ordem do fonte */
+void grafo_incluir_chamadas(int origem, TChamadas *buf) {
+    if (buf->qtd == 0) return;
+    qsort(buf->itens, (size_t)buf->qtd, sizeof(TChamada), comparar_chamadas);
+
+    TNo *o = &nos[origem];
+    o->arestas = sem_alocar(o->arestas, (size_t)(o->num_arestas + buf->qtd) * sizeof(TAresta));
+    for (int i = 0; i < buf->qtd; i++) {
+        int destino = buf->itens[i].destino;
+        nos[destino].chamadas++;
+        if (buf->itens[i].em_laco) nos[destino].chamadas_em_laco++;
+
+        if (o->num_arestas > 0 && o->arestas[o->num_arestas - 1].destino == destino) {
+            o->arestas[o->num_arestas - 1].chamadas++;
+        } else {
+            o->arestas[o->num_arestas].destino = destino;
+            o->arestas[o->num_arestas].chamadas = 1;
+            o->num_arestas++;
+        }
+    }
+    free(buf->itens);
+    buf->itens = NULL;
+    buf->qtd = buf->capacidade = 0;
+}
+
+static void marcar_alcancaveis(int id) {
+    if (nos[id].alcancavel) return;
+    nos[id].alcancavel = 1;
+    for (int i = 0; i < nos[id].num_arestas; i++) {
+        marcar_alcancaveis(nos[id].arestas[i].destino);
+    }
+}
+
+/* Tarjan: cada componente com mais de um nó (ou com laço próprio) é um ciclo de recursão */
+static int *pilha = NULL;
+static int topo_pilha = 0, proximo_indice = 0, num_componentes = 0;
+
+static void tarjan(int id) {
+    TNo *n = &nos[id];
+    n->indice = n->menor = proximo_indice++;
+    pilha[topo_pilha++] = id;
+    n->na_pilha = 1;
+
+    for (int i = 0; i < n->num_arestas; i++) {
+        int d = n->arestas[i].destino;
+        if (d == id) n->recursiva = 1;
+        if (nos[d].indice < 0) {
+            tarjan(d);
+            n = &nos[id];
+            if (nos[d].menor < n->menor) n->menor = nos[d].menor;
+        } else if (nos[d].na_pilha && nos[d].indice < n->menor) {
+            n->menor = nos[d].indice;
+        }
+    }
+
+    if (n->menor == n->indice) {
+        int inicio = topo_pilha, membro;
+        do {
+            membro = pilha[--inicio];
+        } while (membro != id);
+        int tamanho = topo_pilha - inicio;
+        for (int i = inicio; i < topo_pilha; i++) {
+            nos[pilha[i]].na_pilha = 0;
+            nos[pilha[i]].componente = num_componentes;
+            if (tamanho > 1) nos[pilha[i]].recursiva = 1;
+        }
+        topo_pilha = inicio;
+        num_componentes++;
+    }
+}
+
+static void relatar_ciclos(FILE *saida) {
+    for (int c = 0; c < num_componentes; c++) {
+        int primeiro = 1;
+        for (int id = 1; id < num_nos; id++) {
+            if (nos[id].componente != c || !nos[id].recursiva) continue;
+            fprintf(saida, primeiro ? "  recursão: %s" : " <-> %s", nos[id].nome);
+            primeiro = 0;
+        }
+        if (!primeiro) fprintf(saida, "\n");
+    }
+}
+
+void grafo_relatar(FILE *saida, int detalhado) {
+    marcar_alcancaveis(GRAFO_PRINCIPAL);
+    for (int id = 1; id < num_nos; id++) {
+        if (!nos[id].alcancavel) {
+            fprintf(saida, "[AVISO] Linha %d: subrotina '%s' inalcançável a partir do programa principal\n",
+                    nos[id].linha, nos[id].nome);
+        }
+    }
+    if (!detalhado) return;
+
+    pilha = sem_alocar(pilha, (size_t)num_nos * sizeof(int));
+    for (int id = 0; id < num_nos; id++) {
+        if (nos[id].indice < 0) tarjan(id);
+    }
+
+    fprintf(saida, "Grafo de chamadas:\n");
+    for (int id = 0; id < num_nos; id++) {
+        TNo *n = &nos[id];
+        if (id == GRAFO_PRINCIPAL) {
+            fprintf(saida, "  %s\n", n->nome);
+        } else {
+            fprintf(saida, "  %s (linha %d): %d chamada(s), %d em laço, %ld átomo(s)",
+                    n->nome, n->linha, n->chamadas, n->chamadas_em_laco, n->atomos);
+            if (!n->alcancavel) {
+                fprintf(saida, " [removível]");
+            } else if (!n->recursiva && n->atomos <= LIMITE_INLINE) {
+                fprintf(saida, " [candidata a inline]");
+            }
+            fprintf(saida, "\n");
+        }
+        for (int i = 0; i < n->num_arestas; i++) {
+            fprintf(saida, "    -> %s (%d)\n", nos[n->arestas[i].destino].nome, n->arestas[i].chamadas);
+        }
+    }
+    relatar_ciclos(saida);
+}
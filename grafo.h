@@ -0,0 +1,42 @@
+#ifndef GRAFO_H
+#define GRAFO_H
+
+#include <stdio.h>
+
+// Subrotinas com corpo de até tantos átomos, não recursivas, são candidatas a inline
+#define LIMITE_INLINE 40
+
+// Nó 0 é sempre o bloco principal do programa
+#define GRAFO_PRINCIPAL 0
+
+// Cria o nó do bloco principal; chamado uma vez antes da análise
+void grafo_iniciar(void);
+
+// Cria o nó de uma subrotina (ids crescem na ordem do fonte); 'nome' é internado
+// e não é copiado
+int grafo_nova_subrotina(const char *nome, int linha);
+void grafo_definir_tamanho(int id, long atomos);
+
+// Chamadas feitas num corpo, anotadas sem trava pela thread que o verifica
+typedef struct {
+    int destino;
+    int em_laco;        // dentro de for/while/repeat
+} TChamada;
+
+typedef struct {
+    TChamada *itens;
+    int qtd;
+    int capacidade;
+} TChamadas;
+
+void grafo_anotar_chamada(TChamadas *buf, int destino, int em_laco);
+
+// Junta ao grafo as chamadas do corpo de 'origem' e libera o buffer; chamada
+// depois que as threads terminam, um corpo por vez
+void grafo_incluir_chamadas(int origem, TChamadas *buf);
+
+// Avisa em 'saida' sobre subrotinas inalcançáveis; com 'detalhado' imprime também
+// contagem de chamadas, ciclos de recursão e candidatas a inline
+void grafo_relatar(FILE *saida, int detalhado);
+
+#endif
@@ -0,0 +1,491 @@
+/* Gerador da tabela LL(1) da LPD.
+ *
+ * A gramática de declarações, comandos e expressões, com as ações semânticas,
+ * está escrita uma única vez em 'producoes'. O gerador calcula anuláveis,
+ * FIRST e FOLLOW como máscaras de bits, monta a tabela LL(1), reporta os
+ * conflitos em stderr e escreve em stdout o cabeçalho tabela_ll1.h, que o
+ * parser percorre com uma pilha explícita:
+ *
+ *   gcc -std=c11 -Wall -Wextra -O2 gramatica.c -o gerar_tabela
+ *   ./gerar_tabela > tabela_ll1.h
+ *   ./gerar_tabela --tabela      (imprime FIRST, FOLLOW e a tabela LL(1))
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+/* Terminais: grafia na gramática e átomo do scanner que os representa */
+typedef struct { const char *nome; const char *atomo; } TTerminal;
+
+static const TTerminal terminais[] = {
+    {"$",      "T_FIM"},
+    {"prg",    "T_PRG"},    {"var",    "T_VAR"},    {"subrot", "T_SUBROT"},
+    {"int",    "T_INT"},    {"float",  "T_FLOAT"},  {"char",   "T_CHAR"},   {"void", "T_VOID"},
+    {"read",   "T_READ"},   {"write",  "T_WRITE"},  {"if",     "T_IF"},     {"then", "T_THEN"},
+    {"else",   "T_ELSE"},   {"for",    "T_FOR"},    {"while",  "T_WHILE"},  {"repeat", "T_REPEAT"},
+    {"until",  "T_UNTIL"},  {"begin",  "T_BEGIN"},  {"end",    "T_END"},    {"return", "T_RETURN"},
+    {"ID",     "T_ID"},
+    {"LIT_INT", "T_LITERAL_INT"}, {"LIT_FLOAT", "T_LITERAL_FLOAT"},
+    {"LIT_CHAR", "T_LITERAL_CHAR"}, {"LIT_STRING", "T_LITERAL_STRING"},
+    {"<-",     "T_OP_ATRIB"},
+    {"+",      "T_OP_ARIT"}, {"-", "T_OP_ARIT"}, {"*", "T_OP_ARIT"}, {"/", "T_OP_ARIT"},
+    {"OP_REL", "T_OP_REL"},
+    {"and",    "T_OP_LOG"}, {"or", "T_OP_LOG"}, {"not", "T_OP_LOG"},
+    {"(", "T_DELIM"}, {")", "T_DELIM"}, {",", "T_DELIM"}, {";", "T_DELIM"},
+    {".", "T_DELIM"}, {":", "T_DELIM"},
+};
+#define NUM_TERMINAIS ((int)(sizeof(terminais) / sizeof(terminais[0])))
+
+/* Gramática: "cabeça -> corpo", símbolos separados por espaço, corpo vazio = ε.
+   A primeira produção define o símbolo inicial. "@nome" é uma ação semântica:
+   não lê átomo (conta como ε nos conjuntos) e é executada pelo parser.c quando
+   sai da pilha; ações depois de um terminal usam o átomo recém-casado.
+   Num conflito LL(1) fica na tabela a produção listada primeiro. */
+static const char *producoes[] = {
+    /* corpo: a thread principal só registra e pula; as threads de verificação
+       analisam cada corpo a partir de 'bloco' */
+    "programa -> prg ID ; @programa secao_var subrotinas corpo @fim_subrot .",
+    "corpo -> bloco",
+
+    "secao_var -> var decl_var ; decls_var",
+    "secao_var -> decls_var",
+    "decls_var -> decl_var ; decls_var",
+    "decls_var ->",
+    "decl_var -> tipo @dado ID @var vars_tipadas @descartar",
+    "decl_var -> @contar ID @var_sem_tipo ids : tipo @dado @tipar",
+    "vars_tipadas -> , ID @var vars_tipadas",
+    "vars_tipadas ->",
+    "ids -> , ID @var_sem_tipo ids",
+    "ids ->",
+    "tipo -> int @tipo",
+    "tipo -> float @tipo",
+    "tipo -> char @tipo",
+    "tipo -> void @tipo",
+
+    "subrotinas -> subrotina subrotinas",
+    "subrotinas ->",
+    "subrotina -> subrot cabecalho pv_opt secao_var subrotinas corpo @fim_subrot pv_opt",
+    "cabecalho -> tipo ID @subrot ( parametros )",
+    "cabecalho -> @sem_tipo ID @subrot ( parametros ) retorno",
+    "retorno -> : tipo @retorno",
+    "retorno ->",
+    "pv_opt -> ;",
+    "pv_opt ->",
+    "parametros -> tipo @dado ID @param params_tipo",
+    "parametros -> @contar ID @param_sem_tipo ids_param : tipo @dado @tipar_params",
+    "parametros ->",
+    "params_tipo -> , tipo @dado ID @param params_tipo",
+    "params_tipo ->",
+    "ids_param -> , ID @param_sem_tipo ids_param",
+    "ids_param ->",
+
+    /* só declarações tipo-first: com decl_var, "ID ids : tipo" disputaria o
+       'ID' com a atribuição que inicia os comandos */
+    "bloco -> begin @abrir_escopo decls_locais comandos @fechar_escopo end",
+    "decls_locais -> decl_local ; decls_locais",
+    "decls_locais ->",
+    "decl_local -> tipo @dado ID @var vars_tipadas @descartar",
+    "comandos -> comando separador comandos",
+    "comandos ->",
+    "separador -> ; separador",
+    "separador ->",
+
+    "comando -> ID @nome resto_id",
+    "comando -> cmd_read",
+    "comando -> cmd_write",
+    "comando -> cmd_return",
+    "comando -> bloco",
+    "comando -> cmd_if",
+    "comando -> cmd_while",
+    "comando -> cmd_for",
+    "comando -> cmd_repeat",
+    "resto_id -> @variavel <- expressao @atribuicao",
+    "resto_id -> chamada @descartar",
+    "cmd_if -> if ( @linha expressao @condicao ) then comando senao",
+    "senao -> else comando",       /* o else fica com o if mais próximo */
+    "senao ->",
+    "cmd_while -> while ( @laco @linha expressao @condicao ) comando @fim_laco",
+    "cmd_for -> for ( atrib_opt ; @laco @linha expressao @condicao ; atrib_opt ) comando @fim_laco",
+    "atrib_opt -> ID @nome @variavel <- expressao @atribuicao",
+    "atrib_opt ->",
+    "cmd_repeat -> repeat @laco comando until ( @linha expressao @condicao ) @fim_laco",
+    "cmd_read -> read ( ID @ler lidos )",
+    "lidos -> , ID @ler lidos",
+    "lidos ->",
+    "cmd_write -> write ( item_write itens_write )",
+    "itens_write -> , item_write itens_write",
+    "itens_write ->",
+    "item_write -> LIT_STRING",    /* literal string/char vai direto, não como expressão */
+    "item_write -> LIT_CHAR",
+    "item_write -> @linha expressao @escrito",
+    "cmd_return -> @linha return retorno_expr",
+    "retorno_expr -> expressao @retorno_valor",   /* ID depois de return é o valor */
+    "retorno_expr -> @retorno_vazio",
+
+    "expressao -> expr_rel expr_log",
+    "expr_log -> and @op expr_rel @logico expr_log",
+    "expr_log -> or @op expr_rel @logico expr_log",
+    "expr_log ->",
+    "expr_rel -> expr_arit rel_opt",
+    "rel_opt -> OP_REL @op expr_arit @relacional",
+    "rel_opt ->",
+    "expr_arit -> termo soma",
+    "soma -> + @op termo @aritmetico soma",
+    "soma -> - @op termo @aritmetico soma",
+    "soma ->",
+    "termo -> fator produto",
+    "produto -> * @op fator @aritmetico produto",
+    "produto -> / @op fator @aritmetico produto",
+    "produto ->",
+    "fator -> ( expressao )",
+    "fator -> not @op fator @nao",
+    "fator -> ID @nome chamada_opt",
+    "fator -> LIT_INT @literal",
+    "fator -> LIT_FLOAT @literal",
+    "fator -> LIT_CHAR @literal",
+    "fator -> LIT_STRING @literal",
+    "chamada_opt -> chamada",
+    "chamada_opt -> @valor",
+    "chamada -> @chamada ( argumentos ) @fim_chamada",
+    "argumentos -> @linha expressao @argumento mais_args",
+    "argumentos ->",
+    "mais_args -> , @linha expressao @argumento mais_args",
+    "mais_args ->",
+};
+#define NUM_PRODUCOES ((int)(sizeof(producoes) / sizeof(producoes[0])))
+
+#define MAX_NAO_TERMINAIS 64
+#define MAX_ACOES 64
+#define MAX_CORPO 24
+#define MAX_NOME 32
+#define BASE_ACAO 1000
+
+typedef uint64_t TConj;   /* bit i = terminais[i] */
+
+/* símbolo: 0..NUM_TERMINAIS-1 terminal, < 0 não-terminal -(n+1),
+   >= BASE_ACAO ação BASE_ACAO+a */
+typedef struct {
+    int cabeca;
+    int corpo[MAX_CORPO];
+    int tamanho;
+} TProducao;
+
+static char nao_terminais[MAX_NAO_TERMINAIS][MAX_NOME];
+static int num_nao_terminais = 0;
+static char acoes[MAX_ACOES][MAX_NOME];
+static int num_acoes = 0;
+static TProducao prods[NUM_PRODUCOES];
+
+static int anulavel[MAX_NAO_TERMINAIS];
+static TConj first[MAX_NAO_TERMINAIS];
+static TConj follow[MAX_NAO_TERMINAIS];
+static int tabela[MAX_NAO_TERMINAIS][NUM_TERMINAIS];   /* produção ou -1 */
+
+static int buscar_terminal(const char *nome) {
+    for (int i = 0; i < NUM_TERMINAIS; i++) {
+        if (strcmp(terminais[i].nome, nome) == 0) return i;
+    }
+    return -1;
+}
+
+static int buscar_ou_criar(char nomes[][MAX_NOME], int *qtd, int max, const char *nome) {
+    for (int i = 0; i < *qtd; i++) {
+        if (strcmp(nomes[i], nome) == 0) return i;
+    }
+    if (*qtd == max) {
+        fprintf(stderr, "gramatica: símbolos demais (%s)\n", nome);
+        exit(1);
+    }
+    strncpy(nomes[*qtd], nome, MAX_NOME-1);
+    return (*qtd)++;
+}
+
+static int nao_terminal(const char *nome) {
+    return buscar_ou_criar(nao_terminais, &num_nao_terminais, MAX_NAO_TERMINAIS, nome);
+}
+
+static int eh_acao(int s) { return s >= BASE_ACAO; }
+static int eh_terminal(int s) { return s >= 0 && s < BASE_ACAO; }
+
+static void ler_producoes(void) {
+    for (int p = 0; p < NUM_PRODUCOES; p++) {
+        char buf[256], *tok;
+        strncpy(buf, producoes[p], sizeof(buf)-1);
+        buf[sizeof(buf)-1] = '\0';
+
+        tok = strtok(buf, " ");
+        prods[p].cabeca = nao_terminal(tok);
+        tok = strtok(NULL, " ");
+        if (!tok || strcmp(tok, "->") != 0) {
+            fprintf(stderr, "gramatica: produção mal formada: %s\n", producoes[p]);
+            exit(1);
+        }
+        prods[p].tamanho = 0;
+        while ((tok = strtok(NULL, " ")) != NULL) {
+            if (prods[p].tamanho == MAX_CORPO) {
+                fprintf(stderr, "gramatica: corpo longo demais: %s\n", producoes[p]);
+                exit(1);
+            }
+            int t = buscar_terminal(tok), s;
+            if (t >= 0) s = t;
+            else if (tok[0] == '@') s = BASE_ACAO + buscar_ou_criar(acoes, &num_acoes, MAX_ACOES, tok + 1);
+            else s = -(nao_terminal(tok) + 1);
+            prods[p].corpo[prods[p].tamanho++] = s;
+        }
+    }
+
+    /* todo não-terminal citado precisa ter ao menos uma produção */
+    for (int n = 0; n < num_nao_terminais; n++) {
+        int tem = 0;
+        for (int p = 0; p < NUM_PRODUCOES && !tem; p++) tem = prods[p].cabeca == n;
+        if (!tem) {
+            fprintf(stderr, "gramatica: '%s' não tem produções\n", nao_terminais[n]);
+            exit(1);
+        }
+    }
+}
+
+/* FIRST de corpo[i..] e se essa sequência é anulável (ações não leem átomos) */
+static TConj first_sequencia(const TProducao *p, int i, int *seq_anulavel) {
+    TConj r = 0;
+    for (; i < p->tamanho; i++) {
+        int s = p->corpo[i];
+        if (eh_acao(s)) continue;
+        if (eh_terminal(s)) {
+            r |= (TConj)1 << s;
+            *seq_anulavel = 0;
+            return r;
+        }
+        r |= first[-s - 1];
+        if (!anulavel[-s - 1]) {
+            *seq_anulavel = 0;
+            return r;
+        }
+    }
+    *seq_anulavel = 1;
+    return r;
+}
+
+static void calcular_conjuntos(void) {
+    int mudou = 1;
+    while (mudou) {
+        mudou = 0;
+        for (int p = 0; p < NUM_PRODUCOES; p++) {
+            int a = prods[p].cabeca, anul;
+            TConj f = first_sequencia(&prods[p], 0, &anul);
+            if ((first[a] | f) != first[a]) { first[a] |= f; mudou = 1; }
+            if (anul && !anulavel[a]) { anulavel[a] = 1; mudou = 1; }
+        }
+    }
+
+    follow[prods[0].cabeca] = (TConj)1 << buscar_terminal("$");
+    mudou = 1;
+    while (mudou) {
+        mudou = 0;
+        for (int p = 0; p < NUM_PRODUCOES; p++) {
+            for (int i = 0; i < prods[p].tamanho; i++) {
+                int s = prods[p].corpo[i], anul;
+                if (s >= 0) continue;
+                TConj f = first_sequencia(&prods[p], i + 1, &anul);
+                if (anul) f |= follow[prods[p].cabeca];
+                if ((follow[-s - 1] | f) != follow[-s - 1]) { follow[-s - 1] |= f; mudou = 1; }
+            }
+        }
+    }
+}
+
+static const char* nome_simbolo(int s, char *buf) {
+    if (eh_acao(s)) {
+        snprintf(buf, MAX_NOME + 1, "@%s", acoes[s - BASE_ACAO]);
+        return buf;
+    }
+    return eh_terminal(s) ? terminais[s].nome : nao_terminais[-s - 1];
+}
+
+static void imprimir_producao(FILE *saida, int p) {
+    char buf[MAX_NOME + 1];
+    fprintf(saida, "%s ->", nao_terminais[prods[p].cabeca]);
+    if (prods[p].tamanho == 0) fprintf(saida, " ε");
+    for (int i = 0; i < prods[p].tamanho; i++) {
+        fprintf(saida, " %s", nome_simbolo(prods[p].corpo[i], buf));
+    }
+}
+
+/* Preenche a tabela; cada célula disputada por duas produções é um conflito,
+   resolvido a favor da que já estava (a listada primeiro) */
+static int montar_tabela(FILE *conflitos) {
+    int total = 0;
+    memset(tabela, -1, sizeof(tabela));
+    for (int p = 0; p < NUM_PRODUCOES; p++) {
+        int a = prods[p].cabeca, anul;
+        TConj conj = first_sequencia(&prods[p], 0, &anul);
+        if (anul) conj |= follow[a];
+        for (int t = 0; t < NUM_TERMINAIS; t++) {
+            if (!(conj >> t & 1)) continue;
+            if (tabela[a][t] < 0) {
+                tabela[a][t] = p;
+                continue;
+            }
+            fprintf(conflitos, "conflito LL(1) em %s com '%s': ", nao_terminais[a], terminais[t].nome);
+            imprimir_producao(conflitos, tabela[a][t]);
+            fprintf(conflitos, "  x  ");
+            imprimir_producao(conflitos, p);
+            fprintf(conflitos, "\n");
+            total++;
+        }
+    }
+    return total;
+}
+
+static void maiusculas(char *dest, const char *orig) {
+    while ((*dest++ = (char)toupper((unsigned char)*orig++)) != '\0') { }
+}
+
+/* átomos usados por mais de um terminal (delimitadores, operadores) são
+   separados pelo lexema */
+static int atomo_dividido(int t) {
+    for (int u = 0; u < NUM_TERMINAIS; u++) {
+        if (u != t && strcmp(terminais[u].atomo, terminais[t].atomo) == 0) return 1;
+    }
+    return 0;
+}
+
+static void emitir_simbolo(int s) {
+    char macro[MAX_NOME];
+    if (eh_terminal(s)) {
+        printf(" %d,", s);
+    } else if (eh_acao(s)) {
+        maiusculas(macro, acoes[s - BASE_ACAO]);
+        printf(" SIMB_ACAO(ACAO_%s),", macro);
+    } else {
+        maiusculas(macro, nao_terminais[-s - 1]);
+        printf(" SIMB_NT(NT_%s),", macro);
+    }
+}
+
+static void emitir_cabecalho(void) {
+    char macro[MAX_NOME];
+
+    printf("/* Gerado por gramatica.c (./gerar_tabela > tabela_ll1.h) -- não editar. */\n");
+    printf("#ifndef TABELA_LL1_H\n#define TABELA_LL1_H\n\n#include \"scanner.h\"\n\n");
+
+    printf("/* Terminais; 'lexema' só nos átomos divididos por lexema */\n");
+    printf("typedef struct { TAtomo atomo; const char *lexema; const char *nome; } TTerminalLL1;\n\n");
+    printf("#define NUM_TERMINAIS_LL1 %d\n", NUM_TERMINAIS);
+    printf("static const TTerminalLL1 terminais_ll1[NUM_TERMINAIS_LL1] = {\n");
+    for (int t = 0; t < NUM_TERMINAIS; t++) {
+        printf("    /* %2d */ { %s, ", t, terminais[t].atomo);
+        if (atomo_dividido(t)) printf("\"%s\", ", terminais[t].nome);
+        else printf("NULL, ");
+        printf("\"%s\" },\n", terminais[t].nome);
+    }
+    printf("};\n\n");
+
+    printf("enum {\n");
+    for (int n = 0; n < num_nao_terminais; n++) {
+        maiusculas(macro, nao_terminais[n]);
+        printf("    NT_%s,\n", macro);
+    }
+    printf("    NUM_NAO_TERMINAIS_LL1\n};\n\n");
+
+    printf("/* Ações semânticas, executadas por parser.c */\nenum {\n");
+    for (int a = 0; a < num_acoes; a++) {
+        maiusculas(macro, acoes[a]);
+        printf("    ACAO_%s,\n", macro);
+    }
+    printf("    NUM_ACOES_LL1\n};\n\n");
+
+    printf("/* Símbolo na pilha: terminal, não-terminal ou ação */\n");
+    printf("#define SIMB_NT(n) (NUM_TERMINAIS_LL1 + (n))\n");
+    printf("#define SIMB_ACAO(a) (NUM_TERMINAIS_LL1 + NUM_NAO_TERMINAIS_LL1 + (a))\n\n");
+
+    printf("/* Corpo da produção p, invertido (pronto para empilhar):\n"
+           "   simbolos_ll1[inicio_producao_ll1[p] .. inicio_producao_ll1[p+1]) */\n");
+    printf("#define NUM_PRODUCOES_LL1 %d\n", NUM_PRODUCOES);
+    printf("static const short simbolos_ll1[] = {\n");
+    int inicio[NUM_PRODUCOES + 1], total = 0;
+    for (int p = 0; p < NUM_PRODUCOES; p++) {
+        inicio[p] = total;
+        printf("    /* %2d: ", p);
+        imprimir_producao(stdout, p);
+        printf(" */\n");
+        if (prods[p].tamanho > 0) {
+            printf("   ");
+            for (int i = prods[p].tamanho - 1; i >= 0; i--) emitir_simbolo(prods[p].corpo[i]);
+            printf("\n");
+        }
+        total += prods[p].tamanho;
+    }
+    inicio[NUM_PRODUCOES] = total;
+    printf("};\n\nstatic const short inicio_producao_ll1[NUM_PRODUCOES_LL1 + 1] = {");
+    for (int p = 0; p <= NUM_PRODUCOES; p++) printf("%s%d,", p % 16 ? " " : "\n    ", inicio[p]);
+    printf("\n};\n\n");
+
+    printf("/* M[não-terminal][terminal]: produção a expandir; -1 = erro */\n");
+    printf("static const signed char tabela_ll1[NUM_NAO_TERMINAIS_LL1][NUM_TERMINAIS_LL1] = {\n");
+    for (int n = 0; n < num_nao_terminais; n++) {
+        printf("    /* %s */\n    {", nao_terminais[n]);
+        for (int t = 0; t < NUM_TERMINAIS; t++) printf("%s%d", t ? "," : "", tabela[n][t]);
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    printf("/* Nome e terminais esperados de cada não-terminal (mensagens de erro) */\n");
+    printf("static const struct { const char *nome; const char *esperados; } nao_terminais_ll1[NUM_NAO_TERMINAIS_LL1] = {\n");
+    for (int n = 0; n < num_nao_terminais; n++) {
+        printf("    { \"%s\", \"", nao_terminais[n]);
+        int primeiro = 1;
+        for (int t = 0; t < NUM_TERMINAIS; t++) {
+            if (tabela[n][t] < 0) continue;
+            printf("%s%s", primeiro ? "" : "|", terminais[t].nome);
+            primeiro = 0;
+        }
+        printf("\" },\n");
+    }
+    printf("};\n");
+
+    printf("\n/* Conflitos LL(1) da gramática (fica a produção listada primeiro):\n");
+    montar_tabela(stdout);
+    printf("*/\n\n#endif\n");
+}
+
+static void imprimir_conjunto(const char *rotulo, TConj conj) {
+    printf("  %s:", rotulo);
+    for (int t = 0; t < NUM_TERMINAIS; t++) {
+        if (conj >> t & 1) printf(" %s", terminais[t].nome);
+    }
+    printf("\n");
+}
+
+static void imprimir_tabela(void) {
+    for (int n = 0; n < num_nao_terminais; n++) {
+        printf("%s%s\n", nao_terminais[n], anulavel[n] ? " (anulável)" : "");
+        imprimir_conjunto("FIRST", first[n]);
+        imprimir_conjunto("FOLLOW", follow[n]);
+        for (int t = 0; t < NUM_TERMINAIS; t++) {
+            if (tabela[n][t] < 0) continue;
+            printf("  M[%s, %s] = ", nao_terminais[n], terminais[t].nome);
+            imprimir_producao(stdout, tabela[n][t]);
+            printf("\n");
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    ler_producoes();
+    calcular_conjuntos();
+
+    if (argc > 1 && strcmp(argv[1], "--tabela") == 0) {
+        montar_tabela(stderr);
+        imprimir_tabela();
+        return 0;
+    }
+
+    int conflitos = montar_tabela(stderr);
+    emitir_cabecalho();
+    fprintf(stderr, "%d não-terminais, %d produções, %d ações, %d conflito(s) LL(1)\n",
+            num_nao_terminais, NUM_PRODUCOES, num_acoes, conflitos);
+    return 0;
+}
@@ -1,18 +1,54 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "scanner.h"
+#include "semantico.h"
+#include "grafo.h"
 
 // protótipos do parser
 void iniciar_parser(FILE *fp);
 void analisar_programa_public(void);
+void verificar_corpos(int num_threads);
+
+static int uso(const char *programa) {
+    fprintf(stderr, "Uso: %s [--grafo] [--threads N] <arquivo.lpd>\n", programa);
+    return 1;
+}
+
+/* N decimal de 0 a 1024; 0 usa um por processador */
+static int ler_num_threads(const char *arg, int *num_threads) {
+    char *fim;
+    long n;
+
+    if (!arg) return 0;
+    n = strtol(arg, &fim, 10);
+    if (fim == arg || *fim != '\0' || n < 0 || n > 1024) return 0;
+    *num_threads = (int)n;
+    return 1;
+}
 
 int main(int argc, char *argv[]) {
-    if (argc < 2) {
-        fprintf(stderr, "Uso: %s <arquivo.lpd>\n", argv[0]);
-        return 1;
+    int detalhar_grafo = 0;
+    int num_threads = 0;   /* 0: um por processador */
+    const char *caminho = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--grafo") == 0) {
+            detalhar_grafo = 1;
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            if (!ler_num_threads(i + 1 < argc ? argv[++i] : NULL, &num_threads)) {
+                fprintf(stderr, "--threads exige um número inteiro de 0 a 1024\n");
+                return uso(argv[0]);
+            }
+        } else if (!caminho) {
+            caminho = argv[i];
+        } else {
+            return uso(argv[0]);
+        }
     }
+    if (!caminho) return uso(argv[0]);
 
-    FILE *fp = fopen(argv[1], "r");
+    FILE *fp = fopen(caminho, "r");
     if (!fp) {
         perror("Erro ao abrir arquivo");
         return 1;
@@ -21,7 +57,15 @@ int main(int argc, char *argv[]) {
     iniciar_parser(fp);
     analisar_programa_public();
     fclose(fp);
+    verificar_corpos(num_threads);
+
+    if (sem_total_erros() > 0) {
+        fprintf(stderr, "%d erro(s) semântico(s) encontrado(s).\n", sem_total_erros());
+        return 3;
+    }
+
+    grafo_relatar(stdout, detalhar_grafo);
 
-    printf("OK: análise sintática concluída.\n");
+    printf("OK: análise sintática e semântica concluída.\n");
     return 0;
 }
\ No newline at end of file
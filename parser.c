@@ -1,475 +1,572 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <setjmp.h>
 #include "scanner.h"
-
-
-static TInfoAtomo token_atual;
-
-
+#include "semantico.h"
+#include "grafo.h"
+#include "tabela_ll1.h"   /* tabela LL(1) e produções geradas por gramatica.c */
+
+
+/* Átomo guardado: o lexema fica internado no depósito de cadeias */
+typedef struct {
+    unsigned short tipo;     /* TAtomo */
+    short terminal;          /* coluna em tabela_ll1; -1 se a gramática não o usa */
+    int linha;
+    const char *lexema;
+} TAtomoFonte;
+
+/* Fonte inteiro já separado em átomos: os corpos das subrotinas são relidos
+   pelas threads de verificação semântica a partir do índice do seu 'begin' */
+static TAtomoFonte *atomos = NULL;
+static int num_atomos = 0;
+
+/* Erro sintático adiado; relata-se o de menor posição, onde a análise
+   sequencial teria parado */
+typedef struct {
+    int indice;              /* posição em atomos; -1 se não houve erro */
+    char *msg;
+} TErroSintaxe;
+
+/* Corpo (begin ... end): a thread principal só o pula; a análise sintática e
+   semântica dele é feita por uma thread de verificação */
+typedef struct {
+    int inicio;              /* índice do 'begin' em atomos */
+    TEscopo *escopo;         /* escopos envolventes no início do corpo */
+    int limite;              /* símbolos declarados até ali (retrato congelado) */
+    TTipo tipo_retorno;
+    int id_grafo;
+    TDiagnosticos *diag;
+    TChamadas chamadas;      /* arestas do grafo saindo deste corpo */
+    TErroSintaxe erro;
+} TCorpo;
+
+static TCorpo *corpos = NULL;
+static int num_corpos = 0;
+static atomic_int proximo_corpo;
+
+static TErroSintaxe erro_estrutura = { -1, NULL };   /* fora dos corpos */
+
+/* Valor semântico empilhado pelas ações; cada ação usa só os campos que lhe cabem */
+typedef struct {
+    TTipo tipo;              /* tipo declarado ou da (sub)expressão */
+    int linha;
+    const char *nome;        /* identificador ou operador */
+    TSimbolo *sub;           /* subrotina declarada ou chamada (NULL se inválida) */
+    int id_grafo;            /* dono do corpo (programa ou subrotina) */
+    int qtd;                 /* ids à espera do tipo; argumentos já vistos */
+    TConversao conversao;    /* int -> float inserida pelo operador que deu este valor */
+} TValor;
+
+static _Thread_local int indice_atual = -1;                 /* posição de token_atual em atomos */
+static _Thread_local jmp_buf *recuperacao;
+static _Thread_local TErroSintaxe *erro_atual;
+static _Thread_local TAtomoFonte token_atual;
+static _Thread_local TTipo tipo_retorno_atual = TIPO_VOID;   /* subrotina em análise (bloco principal: void) */
+static _Thread_local TChamadas *chamadas_atuais;            /* do corpo em análise */
+static _Thread_local int nivel_laco = 0;                     /* for/while/repeat envolvendo o ponto atual */
+
+/* pilhas do analisador LL(1): símbolos a reconhecer e valores das ações */
+static _Thread_local short *simbolos;
+static _Thread_local int cap_simbolos;
+static _Thread_local TValor *valores;
+static _Thread_local int num_valores, cap_valores;
+
+
+/* guarda a mensagem e abandona a análise da estrutura ou do corpo atual */
 static void erro_sintaxe(const char *msg, const char *esperado) {
-    fprintf(stderr, "[ERRO SINTÁTICO] Linha %d: %s", token_atual.linha, msg);
-    if (esperado) fprintf(stderr, " (esperado: %s)", esperado);
+    char texto[3 * MAX_LEXEMA + 128];
+    int n = snprintf(texto, sizeof(texto), "[ERRO SINTÁTICO] Linha %d: %s", token_atual.linha, msg);
+    if (esperado) n += snprintf(texto + n, sizeof(texto) - (size_t)n, " (esperado: %.*s)", MAX_LEXEMA, esperado);
     if (token_atual.tipo == T_ERRO) {
-        fprintf(stderr, " [léxico: %s]\n", token_atual.lexema);
+        snprintf(texto + n, sizeof(texto) - (size_t)n, " [léxico: %s]", token_atual.lexema);
     } else {
-        fprintf(stderr, " [encontrei: tipo=%d lex=\"%s\"]\n", token_atual.tipo, token_atual.lexema);
+        snprintf(texto + n, sizeof(texto) - (size_t)n, " [encontrei: tipo=%d lex=\"%s\"]",
+                 token_atual.tipo, token_atual.lexema);
     }
-    exit(2);
+    erro_atual->indice = indice_atual;
+    erro_atual->msg = sem_alocar(NULL, strlen(texto) + 1);
+    strcpy(erro_atual->msg, texto);
+    longjmp(*recuperacao, 1);
 }
 
 static void proximo(void) {
-    token_atual = obter_atomo();
+    if (indice_atual < num_atomos - 1) indice_atual++;
+    token_atual = atomos[indice_atual];
     if (token_atual.tipo == T_ERRO) {
         erro_sintaxe("Token léxico inválido", token_atual.lexema);
     }
 }
 
 static int token_e(TAtomo t) { return token_atual.tipo == t; }
-static int token_e_delim(const char *lex) {
-    return token_atual.tipo == T_DELIM && strcmp(token_atual.lexema, lex) == 0;
-}
-static int token_e_op_arit(const char *lex) {
-    return token_atual.tipo == T_OP_ARIT && (lex ? strcmp(token_atual.lexema, lex)==0 : 1);
-}
-static int token_e_op_log(const char *lex) {
-    return token_atual.tipo == T_OP_LOG && (lex ? strcmp(token_atual.lexema, lex)==0 : 1);
-}
 
-static void casar_token(TAtomo t, const char *lex /*pode ser NULL*/) {
-    if (token_atual.tipo != t) erro_sintaxe("Token inesperado", NULL);
-    if (lex && strcmp(token_atual.lexema, lex) != 0) {
-        erro_sintaxe("Lexema inesperado", lex);
+/* ID usado como variável (alvo de atribuição ou de read); devolve seu tipo */
+static TTipo verificar_variavel(const char *nome, int linha) {
+    TSimbolo *s = sem_buscar(nome);
+    if (!s) {
+        erro_semantico(linha, "identificador '%s' não declarado", nome);
+        return TIPO_ERRO;
     }
-    proximo();
+    if (s->categoria == CAT_SUBROT) {
+        erro_semantico(linha, "'%s' é subrotina e não pode receber valor", nome);
+        return TIPO_ERRO;
+    }
+    return s->tipo;
 }
 
-static void analisar_programa(void);
-static void analisar_secao_var_opt(void);
-static void analisar_decl_var(void);
-static void analisar_tipo(void);
-
-static void analisar_subrotinas_opt(void);
-static void analisar_subrotina(void);
-static void analisar_parametros_opt(void);
-
-static void analisar_bloco(void);
-static void analisar_lista_comandos(void);
-static void analisar_comando(void);
-
-static void analisar_atribuicao(void);
-static void analisar_atribuicao_sem_pv(void);
-static void analisar_if(void);
-static void analisar_while(void);
-static void analisar_for(void);
-static void analisar_repeat(void);
-static void analisar_read(void);
-static void analisar_write(void);
-static void analisar_return(void);
-
-
-static void analisar_expressao(void); 
-static void analisar_expressao_rel(void);      
-static void analisar_expressao_arit(void);       
-static void analisar_termo(void);                    
-static void analisar_fator(void);                     
-
-
-void iniciar_parser(FILE *fp) {
-    arquivo = fp; 
-    proximo();  
+/* void só é válido como retorno de subrotina */
+static void verificar_tipo_dado(TTipo tipo, int linha) {
+    if (tipo == TIPO_VOID) erro_semantico(linha, "variáveis e parâmetros não podem ser void");
 }
 
+/* Coluna da tabela LL(1) para o átomo; os átomos divididos por lexema
+   (operadores, and/or/not, delimitadores) são resolvidos pelo 1º caractere */
+static signed char terminal_por_inicial[T_ERRO + 1][256];
 
-
-static void analisar_programa(void) {
-
-    casar_token(T_PRG, NULL);
-    casar_token(T_ID, NULL);
-    casar_token(T_DELIM, ";");
-
-    analisar_secao_var_opt();
-    analisar_subrotinas_opt();
-
-    analisar_bloco();
-    casar_token(T_DELIM, ".");
-
-    if (!token_e(T_FIM)) {
-        erro_sintaxe("Tokens após término do programa", "EOF");
+static void montar_terminais(void) {
+    memset(terminal_por_inicial, -1, sizeof(terminal_por_inicial));
+    for (int t = 0; t < NUM_TERMINAIS_LL1; t++) {
+        const TTerminalLL1 *term = &terminais_ll1[t];
+        if (term->lexema) terminal_por_inicial[term->atomo][(unsigned char)term->lexema[0]] = (signed char)t;
+        else memset(terminal_por_inicial[term->atomo], t, 256);
     }
 }
 
-static void analisar_subrotinas_opt(void) {
-    while (token_e(T_SUBROT)) {
-        analisar_subrotina();
-    }
+static short terminal_de(TAtomo tipo, const char *lexema) {
+    int t = terminal_por_inicial[tipo][(unsigned char)lexema[0]];
+    if (t >= 0 && terminais_ll1[t].lexema && strcmp(terminais_ll1[t].lexema, lexema) != 0) t = -1;
+    return (short)t;
 }
 
-static void analisar_secao_var_opt(void) {
-    if (token_e(T_VAR)) {
-        casar_token(T_VAR, NULL);
-        while (1) {
-            analisar_decl_var();
-            casar_token(T_DELIM, ";");
-            if (token_e(T_ID) || token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID))
-                continue;
-            break;
+void iniciar_parser(FILE *fp) {
+    arquivo = fp;
+    TInfoAtomo a;
+    int capacidade = 0;
+    montar_terminais();
+    do {
+        a = obter_atomo();
+        if (num_atomos == capacidade) {
+            capacidade = capacidade ? 2 * capacidade : 4096;
+            atomos = sem_alocar(atomos, (size_t)capacidade * sizeof(TAtomoFonte));
         }
-        return;
-    }
-
-    while (token_e(T_ID) || token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        if (token_e(T_BEGIN) || token_e(T_SUBROT)) break;
-
-        analisar_decl_var();
-        casar_token(T_DELIM, ";");
-    }
+        atomos[num_atomos].tipo = a.tipo;
+        atomos[num_atomos].terminal = terminal_de(a.tipo, a.lexema);
+        atomos[num_atomos].linha = a.linha;
+        atomos[num_atomos].lexema = sem_internar(a.lexema);
+        num_atomos++;
+    } while (a.tipo != T_FIM && a.tipo != T_ERRO);
+    grafo_iniciar();
+    proximo();
 }
 
-static void analisar_decl_var(void) {
-    if (token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        analisar_tipo();                 
-        casar_token(T_ID, NULL);     
-        while (token_e_delim(",")) {    
-            casar_token(T_DELIM, ",");
-            casar_token(T_ID, NULL);
-        }
-        return;
-    }
-
-    if (token_e(T_ID)) {
-        casar_token(T_ID, NULL);
-        while (token_e_delim(",")) {
-            casar_token(T_DELIM, ",");
-            casar_token(T_ID, NULL);
+/* Avança do 'begin' atual até depois do 'end' correspondente; devolve o
+   índice desse 'end'. Só blocos usam begin/end, então basta contar. */
+static int pular_corpo(void) {
+    int profundidade = 0;
+    for (;; indice_atual++) {
+        TAtomo t = atomos[indice_atual].tipo;
+        if (t == T_BEGIN) {
+            profundidade++;
+        } else if (t == T_END && --profundidade == 0) {
+            break;
+        } else if (t == T_FIM || t == T_ERRO) {
+            token_atual = atomos[indice_atual];
+            erro_sintaxe(t == T_ERRO ? "Token léxico inválido" : "Token inesperado",
+                         t == T_ERRO ? token_atual.lexema : "end");
         }
-        casar_token(T_DELIM, ":");
-        analisar_tipo();
-        return;
     }
-
-    erro_sintaxe("Declaração de variável inválida", "tipo id...  ou  id : tipo");
+    int fim = indice_atual;
+    proximo();
+    return fim;
 }
 
-static void analisar_tipo(void) {
-    if (token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        proximo();
-    } else {
-        erro_sintaxe("Tipo inválido", "int|float|char|void");
-    }
+/* Registra o corpo do dono (programa ou subrotina) para as threads e o pula
+   sem analisá-lo */
+static void analisar_corpo(const TValor *dono) {
+    if (!token_e(T_BEGIN)) erro_sintaxe("Token inesperado", "begin");
+    if ((num_corpos & (num_corpos - 1)) == 0) {   /* capacidade dobra nas potências de 2 */
+        corpos = sem_alocar(corpos, (size_t)(num_corpos ? 2 * num_corpos : 1) * sizeof(TCorpo));
+    }
+    TCorpo *c = &corpos[num_corpos++];
+    c->inicio = indice_atual;
+    c->escopo = sem_escopo_atual();
+    c->limite = sem_total_declarados();
+    c->tipo_retorno = dono->tipo;
+    c->id_grafo = dono->id_grafo;
+    c->diag = sem_novo_buffer();
+    memset(&c->chamadas, 0, sizeof(TChamadas));
+    c->erro.indice = -1;
+    c->erro.msg = NULL;
+
+    /* tamanho só do corpo, sem as subrotinas aninhadas */
+    grafo_definir_tamanho(dono->id_grafo, pular_corpo() + 1 - c->inicio);
 }
 
-static void analisar_subrotina(void) {
-    casar_token(T_SUBROT, NULL);
-
-    int cabecalho_tipo_first = 0;
-
-    if (token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        analisar_tipo();
-        cabecalho_tipo_first = 1;
-        casar_token(T_ID, NULL);
-    } else {
-        casar_token(T_ID, NULL);
-    }
-
-    casar_token(T_DELIM, "(");
-    analisar_parametros_opt();
-    casar_token(T_DELIM, ")");
-
-    if (!cabecalho_tipo_first && token_e_delim(":")) {
-        casar_token(T_DELIM, ":");
-        analisar_tipo();
-    }
-
-    if (token_e_delim(";")) {
-        casar_token(T_DELIM, ";");
-    }
-
-    analisar_secao_var_opt();
-
-    analisar_subrotinas_opt();
-
-    analisar_bloco();
-
-    if (token_e_delim(";")) {
-        casar_token(T_DELIM, ";");
+/* garante espaço para 'qtd' símbolos na pilha da thread */
+static short* reservar_simbolos(int qtd) {
+    if (qtd > cap_simbolos) {
+        while (qtd > cap_simbolos) cap_simbolos = cap_simbolos ? 2 * cap_simbolos : 256;
+        simbolos = sem_alocar(simbolos, (size_t)cap_simbolos * sizeof(short));
     }
+    return simbolos;
 }
 
-static void analisar_parametros_opt(void) {
-    /* vazio */
-    if (token_e_delim(")")) return;
-
-    if (token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        while (1) {
-            analisar_tipo();
-            casar_token(T_ID, NULL);
-            if (token_e_delim(",")) {
-                casar_token(T_DELIM, ",");
-                continue;
-            }
-            break;
-        }
-        return;
-    }
-
-    if (token_e(T_ID)) {
-        casar_token(T_ID, NULL);
-        while (token_e_delim(",")) {
-            casar_token(T_DELIM, ",");
-            casar_token(T_ID, NULL);
-        }
-        casar_token(T_DELIM, ":");
-        analisar_tipo();
-        return;
+static void empilhar_valor(TValor v) {
+    if (num_valores == cap_valores) {
+        cap_valores = cap_valores ? 2 * cap_valores : 64;
+        valores = sem_alocar(valores, (size_t)cap_valores * sizeof(TValor));
     }
-
-    erro_sintaxe("Parâmetros inválidos", "tipo id  ou  id : tipo");
+    valores[num_valores++] = v;
 }
 
+static TValor desempilhar_valor(void) { return valores[--num_valores]; }
+static TValor* topo_valor(void) { return &valores[num_valores - 1]; }
 
-static void analisar_bloco(void) {
-    casar_token(T_BEGIN, NULL);
-
-    /* Declarações locais opcionais (formato tipo-first) */
-    while (token_e(T_INT) || token_e(T_FLOAT) || token_e(T_CHAR) || token_e(T_VOID)) {
-        analisar_decl_var();      /* já aceita:  tipo id (,id)*  */
-        casar_token(T_DELIM, ";");
+static TTipo tipo_do_atomo(TAtomo t) {
+    switch (t) {
+    case T_INT:   case T_LITERAL_INT:   return TIPO_INT;
+    case T_FLOAT: case T_LITERAL_FLOAT: return TIPO_FLOAT;
+    case T_CHAR:  case T_LITERAL_CHAR:  return TIPO_CHAR;
+    case T_LITERAL_STRING:              return TIPO_STRING;
+    default:                            return TIPO_VOID;
     }
-
-    analisar_lista_comandos();
-    casar_token(T_END, NULL);
 }
 
-static void analisar_lista_comandos(void) {
-    while (1) {
-        if (token_e(T_END)) break;
-
-        analisar_comando();
-
-        if (token_e_delim(";")) {
-            casar_token(T_DELIM, ";");
-            while (token_e_delim(";")) casar_token(T_DELIM, ";");
+/* Ações semânticas da gramática (@nome em gramatica.c). As que seguem um
+   terminal leem o átomo recém-casado; @linha marca o início do que vem. */
+static void executar_acao(int acao) {
+    const TAtomoFonte *casado = &atomos[indice_atual - 1];
+    TValor v = { .tipo = TIPO_ERRO }, dir, op;
+    TValor *topo;
+    TSimbolo *s;
+
+    switch (acao) {
+    /* declarações e cabeçalhos */
+    case ACAO_PROGRAMA:
+        sem_abrir_escopo();
+        v.tipo = TIPO_VOID;
+        v.id_grafo = GRAFO_PRINCIPAL;
+        empilhar_valor(v);
+        break;
+    case ACAO_FIM_SUBROT:
+        desempilhar_valor();
+        sem_fechar_escopo();
+        break;
+    case ACAO_TIPO:
+        v.tipo = tipo_do_atomo(casado->tipo);
+        v.linha = casado->linha;
+        empilhar_valor(v);
+        break;
+    case ACAO_DADO:
+        verificar_tipo_dado(topo_valor()->tipo, topo_valor()->linha);
+        break;
+    case ACAO_VAR:
+        sem_declarar(casado->lexema, CAT_VAR, casado->linha)->tipo = topo_valor()->tipo;
+        break;
+    case ACAO_DESCARTAR:
+        desempilhar_valor();
+        break;
+    case ACAO_CONTAR:
+        empilhar_valor(v);
+        break;
+    case ACAO_VAR_SEM_TIPO:
+        sem_declarar(casado->lexema, CAT_VAR, casado->linha);
+        topo_valor()->qtd++;
+        break;
+    case ACAO_TIPAR:
+        dir = desempilhar_valor();
+        sem_tipar_ultimos(desempilhar_valor().qtd, dir.tipo);
+        break;
+    case ACAO_SEM_TIPO:
+        v.tipo = TIPO_VOID;   /* sem tipo declarado: não retorna valor */
+        empilhar_valor(v);
+        break;
+    case ACAO_SUBROT:
+        /* nome visível no escopo externo (e no próprio corpo, para recursão) */
+        s = sem_declarar(casado->lexema, CAT_SUBROT, casado->linha);
+        s->tipo = desempilhar_valor().tipo;
+        s->id_grafo = grafo_nova_subrotina(casado->lexema, casado->linha);
+        sem_abrir_escopo();
+        v.tipo = s->tipo;
+        v.sub = s;
+        v.id_grafo = s->id_grafo;
+        empilhar_valor(v);
+        break;
+    case ACAO_RETORNO:
+        dir = desempilhar_valor();
+        topo = topo_valor();
+        topo->tipo = topo->sub->tipo = dir.tipo;
+        break;
+    case ACAO_PARAM:
+        dir = desempilhar_valor();
+        sem_declarar(casado->lexema, CAT_PARAM, casado->linha)->tipo = dir.tipo;
+        sem_adicionar_param(topo_valor()->sub, dir.tipo);
+        break;
+    case ACAO_PARAM_SEM_TIPO:
+        sem_declarar(casado->lexema, CAT_PARAM, casado->linha);
+        topo_valor()->qtd++;
+        break;
+    case ACAO_TIPAR_PARAMS:
+        dir = desempilhar_valor();
+        op = desempilhar_valor();
+        sem_tipar_ultimos(op.qtd, dir.tipo);
+        for (int i = 0; i < op.qtd; i++) sem_adicionar_param(topo_valor()->sub, dir.tipo);
+        break;
+
+    /* comandos */
+    case ACAO_ABRIR_ESCOPO:
+        sem_abrir_escopo();
+        break;
+    case ACAO_FECHAR_ESCOPO:
+        sem_fechar_escopo();
+        break;
+    case ACAO_NOME:
+    case ACAO_OP:
+        v.nome = casado->lexema;
+        v.linha = casado->linha;
+        empilhar_valor(v);
+        break;
+    case ACAO_VARIAVEL:
+        topo = topo_valor();
+        topo->tipo = verificar_variavel(topo->nome, topo->linha);
+        break;
+    case ACAO_ATRIBUICAO:
+        dir = desempilhar_valor();
+        op = desempilhar_valor();
+        sem_verificar_atrib(op.tipo, dir.tipo, "atribuição", op.linha);
+        break;
+    case ACAO_LINHA:
+        v.linha = token_atual.linha;
+        empilhar_valor(v);
+        break;
+    case ACAO_CONDICAO:
+        dir = desempilhar_valor();
+        sem_verificar_condicao(dir.tipo, desempilhar_valor().linha);
+        break;
+    case ACAO_LACO:
+        nivel_laco++;   /* condição, atualização e corpo se repetem */
+        break;
+    case ACAO_FIM_LACO:
+        nivel_laco--;
+        break;
+    case ACAO_LER:
+        verificar_variavel(casado->lexema, casado->linha);
+        break;
+    case ACAO_ESCRITO:
+        /* aceita qualquer tipo com valor: só o resultado de subrotina void é recusado */
+        dir = desempilhar_valor();
+        sem_verificar_valor(dir.tipo, "write", desempilhar_valor().linha);
+        break;
+    case ACAO_RETORNO_VALOR:
+        dir = desempilhar_valor();
+        op = desempilhar_valor();
+        if (tipo_retorno_atual == TIPO_VOID) {
+            erro_semantico(op.linha, "return com valor em subrotina void");
         } else {
-            if (token_e(T_END)) break;
-            if (!(token_e(T_ID) || token_e(T_READ) || token_e(T_WRITE) || token_e(T_RETURN) ||
-                  token_e(T_BEGIN) || token_e(T_IF) || token_e(T_WHILE) || token_e(T_FOR) ||
-                  token_e(T_REPEAT))) {
-                break;
-            }
+            sem_verificar_atrib(tipo_retorno_atual, dir.tipo, "return", op.linha);
         }
+        break;
+    case ACAO_RETORNO_VAZIO:
+        op = desempilhar_valor();
+        if (tipo_retorno_atual != TIPO_VOID) {
+            erro_semantico(op.linha, "return sem valor em subrotina %s", sem_nome_tipo(tipo_retorno_atual));
+        }
+        break;
+
+    /* expressões: o operando esquerdo fica no topo e recebe o tipo do resultado */
+    case ACAO_LOGICO:
+    case ACAO_RELACIONAL:
+    case ACAO_ARITMETICO:
+        dir = desempilhar_valor();
+        op = desempilhar_valor();
+        topo = topo_valor();
+        if (acao == ACAO_LOGICO) {
+            topo->tipo = sem_tipo_logico(topo->tipo, dir.tipo, op.nome, op.linha);
+            topo->conversao = CONV_NENHUMA;
+        } else if (acao == ACAO_RELACIONAL) {
+            topo->tipo = sem_tipo_relacional(topo->tipo, dir.tipo, op.nome, op.linha, &topo->conversao);
+        } else {
+            topo->tipo = sem_tipo_aritmetico(topo->tipo, dir.tipo, op.nome, op.linha, &topo->conversao);
+        }
+        break;
+    case ACAO_NAO:
+        dir = desempilhar_valor();
+        topo = topo_valor();   /* o 'not' dá lugar ao resultado */
+        topo->tipo = sem_tipo_logico(dir.tipo, dir.tipo, "not", topo->linha);
+        break;
+    case ACAO_LITERAL:
+        v.tipo = tipo_do_atomo(casado->tipo);
+        empilhar_valor(v);
+        break;
+    case ACAO_VALOR:
+        topo = topo_valor();
+        s = sem_buscar(topo->nome);
+        if (!s) {
+            erro_semantico(topo->linha, "identificador '%s' não declarado", topo->nome);
+        } else if (s->categoria == CAT_SUBROT) {
+            erro_semantico(topo->linha, "subrotina '%s' usada como valor sem chamada (falta \"(...)\")", topo->nome);
+        } else {
+            topo->tipo = s->tipo;
+        }
+        break;
+    case ACAO_CHAMADA:
+        topo = topo_valor();
+        s = sem_buscar(topo->nome);
+        topo->sub = (s && s->categoria == CAT_SUBROT) ? s : NULL;
+        topo->qtd = 0;
+        if (!s) {
+            erro_semantico(topo->linha, "identificador '%s' não declarado", topo->nome);
+        } else if (!topo->sub) {
+            erro_semantico(topo->linha, "'%s' não é subrotina", topo->nome);
+        }
+        break;
+    case ACAO_ARGUMENTO:
+        dir = desempilhar_valor();
+        op = desempilhar_valor();
+        topo = topo_valor();   /* a chamada */
+        if (topo->sub && topo->qtd < topo->sub->num_params) {
+            char contexto[MAX_LEXEMA + 32];
+            snprintf(contexto, sizeof(contexto), "argumento %d de '%s'", topo->qtd + 1, topo->sub->nome);
+            sem_verificar_atrib(topo->sub->tipos_params[topo->qtd], dir.tipo, contexto, op.linha);
+        }
+        topo->qtd++;
+        break;
+    case ACAO_FIM_CHAMADA:
+        topo = topo_valor();
+        if (!topo->sub) {
+            topo->tipo = TIPO_ERRO;
+            break;
+        }
+        grafo_anotar_chamada(chamadas_atuais, topo->sub->id_grafo, nivel_laco > 0);
+        if (topo->qtd != topo->sub->num_params) {
+            erro_semantico(topo->linha, "subrotina '%s' espera %d argumento(s), recebeu %d",
+                           topo->nome, topo->sub->num_params, topo->qtd);
+        }
+        topo->tipo = topo->sub->tipo;
+        break;
     }
 }
 
-/* despacho por 1º token */
-static void analisar_comando(void) {
-    if (token_e(T_ID)) {
-        analisar_atribuicao();
-    } else if (token_e(T_READ)) {
-        analisar_read();
-    } else if (token_e(T_WRITE)) {
-        analisar_write();
-    } else if (token_e(T_RETURN)) {
-        analisar_return();
-    } else if (token_e(T_BEGIN)) {
-        analisar_bloco();
-    } else if (token_e(T_IF)) {
-        analisar_if();
-    } else if (token_e(T_WHILE)) {
-        analisar_while();
-    } else if (token_e(T_FOR)) {
-        analisar_for();
-    } else if (token_e(T_REPEAT)) {
-        analisar_repeat();
-    } else {
-        erro_sintaxe("Início de comando inválido", NULL);
-    }
-}
-
-/* ID <- expressao */
-static void analisar_atribuicao(void) {
-    casar_token(T_ID, NULL);
-    casar_token(T_OP_ATRIB, NULL);
-    analisar_expressao();
-}
-
-static void analisar_atribuicao_sem_pv(void) {
-    casar_token(T_ID, NULL);
-    casar_token(T_OP_ATRIB, NULL); /* "<-" */
-    analisar_expressao();
-}
-
-/* if (expressao) then comando [ else comando ] */
-static void analisar_if(void) {
-    casar_token(T_IF, NULL);
-    casar_token(T_DELIM, "(");
-    analisar_expressao();
-    casar_token(T_DELIM, ")");
-
-    casar_token(T_THEN, NULL);
-    analisar_comando();
-
-    if (token_e(T_ELSE)) {
-        casar_token(T_ELSE, NULL);
-        analisar_comando();
-    }
-}
-
-/* while (expressao) comando */
-static void analisar_while(void) {
-    casar_token(T_WHILE, NULL);
-    casar_token(T_DELIM, "(");
-    analisar_expressao();
-    casar_token(T_DELIM, ")");
-    analisar_comando();
-}
-
-/* for ( init ; cond ; update ) comando  */
-static void analisar_for(void) {
-    casar_token(T_FOR, NULL);
-    casar_token(T_DELIM, "(");
-
-    if (token_e(T_ID)) {
-        analisar_atribuicao_sem_pv();
-    }
-    casar_token(T_DELIM, ";");
-
-    analisar_expressao();
-    casar_token(T_DELIM, ";");
-
-    if (token_e(T_ID)) {
-        analisar_atribuicao_sem_pv();
-    }
-    casar_token(T_DELIM, ")");
-
-    analisar_comando();
-}
-
-/* repeat comando(s) until (expressao) */
-static void analisar_repeat(void) {
-    casar_token(T_REPEAT, NULL);
-    if (token_e(T_BEGIN)) {
-        analisar_bloco();
-    } else {
-        analisar_comando();
-    }
-    casar_token(T_UNTIL, NULL);
-    casar_token(T_DELIM, "(");
-    analisar_expressao();
-    casar_token(T_DELIM, ")");
-}
-
-/* read( lista ) ;   onde lista = ID ( , ID )*  */
-static void analisar_read(void) {
-    casar_token(T_READ, NULL);
-    casar_token(T_DELIM, "(");
-    casar_token(T_ID, NULL);
-    while (token_e_delim(",")) {
-        casar_token(T_DELIM, ",");
-        casar_token(T_ID, NULL);
-    }
-    casar_token(T_DELIM, ")");
-}
-
-/* write( lista ) ;   onde lista = (expressao | string | char) ( , ... )*  */
-static void analisar_write(void) {
-    casar_token(T_WRITE, NULL);
-    casar_token(T_DELIM, "(");
-    if (token_e(T_LITERAL_STRING) || token_e(T_LITERAL_CHAR)) {
-        proximo();
-    } else {
-        analisar_expressao();
-    }
-    while (token_e_delim(",")) {
-        casar_token(T_DELIM, ",");
-        if (token_e(T_LITERAL_STRING) || token_e(T_LITERAL_CHAR)) {
+/* Analisador LL(1) de pilha explícita: expande o não-terminal do topo pela
+   produção de tabela_ll1[nt][terminal], casa terminais e executa as ações.
+   Na thread principal o não-terminal 'corpo' só registra e pula o bloco.
+   Só este laço mexe na pilha de símbolos, mantida em variáveis locais. */
+static void analisar_ll1(int inicial) {
+    short *pilha = reservar_simbolos(1);
+    int n = 0;
+    pilha[n++] = SIMB_NT(inicial);
+    while (n > 0) {
+        int s = pilha[--n];
+        if (s < NUM_TERMINAIS_LL1) {
+            if (token_atual.terminal != s) {
+                erro_sintaxe(token_atual.tipo == terminais_ll1[s].atomo ? "Lexema inesperado" : "Token inesperado",
+                             terminais_ll1[s].nome);
+            }
             proximo();
+        } else if (s >= SIMB_ACAO(0)) {
+            executar_acao(s - SIMB_ACAO(0));
+        } else if (s == SIMB_NT(NT_CORPO)) {
+            analisar_corpo(topo_valor());
         } else {
-            analisar_expressao();
+            int nt = s - NUM_TERMINAIS_LL1;
+            int p = token_atual.terminal < 0 ? -1 : tabela_ll1[nt][token_atual.terminal];
+            if (p < 0) {
+                char msg[64];
+                snprintf(msg, sizeof(msg), "Token inesperado em %s", nao_terminais_ll1[nt].nome);
+                erro_sintaxe(msg, nao_terminais_ll1[nt].esperados);
+            }
+            int ini = inicio_producao_ll1[p], qtd = inicio_producao_ll1[p + 1] - ini;
+            if (n + qtd > cap_simbolos) pilha = reservar_simbolos(n + qtd);
+            for (int i = 0; i < qtd; i++) pilha[n + i] = simbolos_ll1[ini + i];
+            n += qtd;
         }
     }
-    casar_token(T_DELIM, ")");
 }
 
-static void analisar_return(void) {
-    casar_token(T_RETURN, NULL);
-    if (!(token_e_delim(";"))) {
-        analisar_expressao();
-    }
-}
+/* Estrutura do programa: declarações e cabeçalhos; os corpos são pulados */
+void analisar_programa_public(void) {
+    jmp_buf desvio;
+    recuperacao = &desvio;
+    erro_atual = &erro_estrutura;
+    if (setjmp(desvio) != 0) return;
 
-/* expressão_lógica ::= expressão_rel ( (and|or) expressão_rel )* */
-static void analisar_expressao(void) {
-    analisar_expressao_rel();
-    while (token_e_op_log("and") || token_e_op_log("or")) {
-        proximo();
-        analisar_expressao_rel();
+    num_valores = 0;
+    analisar_ll1(NT_PROGRAMA);
+    if (!token_e(T_FIM)) {
+        erro_sintaxe("Tokens após término do programa", "EOF");
     }
 }
 
-/* expressão_rel ::= expressão_arit ( OP_REL expressão_arit )? */
-static void analisar_expressao_rel(void) {
-    analisar_expressao_arit();
-    if (token_e(T_OP_REL)) {
-        proximo(); /* == != < > <= >= */
-        analisar_expressao_arit();
-    }
-}
+static void verificar_corpo(TCorpo *c) {
+    jmp_buf desvio;
+    recuperacao = &desvio;
+    erro_atual = &c->erro;
+    if (setjmp(desvio) != 0) return;
 
-/* expressão_arit ::= termo ( ('+'|'-') termo )* */
-static void analisar_expressao_arit(void) {
-    analisar_termo();
-    while (token_e_op_arit("+") || token_e_op_arit("-")) {
-        proximo();
-        analisar_termo();
-    }
+    indice_atual = c->inicio - 1;
+    proximo();
+    tipo_retorno_atual = c->tipo_retorno;
+    chamadas_atuais = &c->chamadas;
+    nivel_laco = 0;
+    num_valores = 0;
+    sem_restaurar_escopo(c->escopo, c->limite);
+    sem_usar_diagnosticos(c->diag);
+    analisar_ll1(NT_BLOCO);
 }
 
-/* termo ::= fator ( ('*'|'/') fator )* */
-static void analisar_termo(void) {
-    analisar_fator();
-    while (token_e_op_arit("*") || token_e_op_arit("/")) {
-        proximo();
-        analisar_fator();
-    }
+static void* trabalhador_semantico(void *arg) {
+    (void)arg;
+    int i;
+    while ((i = atomic_fetch_add(&proximo_corpo, 1)) < num_corpos) {
+        verificar_corpo(&corpos[i]);
+    }
+    free(simbolos);
+    free(valores);
+    simbolos = NULL;
+    valores = NULL;
+    cap_simbolos = cap_valores = 0;
+    return NULL;
 }
 
-static void analisar_fator(void) {
-    if (token_e_delim("(")) {
-        casar_token(T_DELIM, "(");
-        analisar_expressao();
-        casar_token(T_DELIM, ")");
-        return;
+/* Relata o erro sintático de menor posição e encerra (código 2). Os corpos não
+   se sobrepõem; no empate com a estrutura vale o do corpo, achado antes. */
+static void relatar_erro_sintaxe(void) {
+    const TErroSintaxe *primeiro = NULL;
+    for (int i = 0; i < num_corpos; i++) {
+        const TErroSintaxe *e = &corpos[i].erro;
+        if (e->indice >= 0 && (!primeiro || e->indice < primeiro->indice)) primeiro = e;
     }
-    if (token_e_op_log("not")) {
-        proximo();
-        analisar_fator();
-        return;
+    if (erro_estrutura.indice >= 0 && (!primeiro || erro_estrutura.indice < primeiro->indice)) {
+        primeiro = &erro_estrutura;
     }
-    if (token_e(T_ID)) {
-        proximo();
-        if (token_e_delim("(")) {
-            casar_token(T_DELIM, "(");
-            if (!token_e_delim(")")) {
-                analisar_expressao();
-                while (token_e_delim(",")) {
-                    casar_token(T_DELIM, ",");
-                    analisar_expressao();
-                }
-            }
-            casar_token(T_DELIM, ")");
-        }
-        return;
-    }
-    if (token_e(T_LITERAL_INT) || token_e(T_LITERAL_FLOAT) ||
-        token_e(T_LITERAL_CHAR) || token_e(T_LITERAL_STRING)) {
-        proximo();
-        return;
-    }
-
-    erro_sintaxe("Fator inválido em expressão", NULL);
+    if (!primeiro) return;
+    fprintf(stderr, "%s\n", primeiro->msg);
+    exit(2);
 }
 
-void analisar_programa_public(void) {
-    analisar_programa();
+/* Verifica os corpos em paralelo (num_threads <= 0: um por processador) e
+   emite os diagnósticos na ordem do fonte, independente do nº de threads */
+void verificar_corpos(int num_threads) {
+    if (num_threads <= 0) num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_threads > num_corpos) num_threads = num_corpos;
+    if (num_threads < 1) num_threads = 1;
+
+    pthread_t *threads = sem_alocar(NULL, (size_t)num_threads * sizeof(pthread_t));
+    atomic_store(&proximo_corpo, 0);
+    int criadas = 0;
+    for (; criadas < num_threads - 1; criadas++) {
+        if (pthread_create(&threads[criadas], NULL, trabalhador_semantico, NULL) != 0) break;
+    }
+    trabalhador_semantico(NULL);   /* a thread principal também trabalha */
+    for (int i = 0; i < criadas; i++) pthread_join(threads[i], NULL);
+    free(threads);
+
+    relatar_erro_sintaxe();
+    for (int i = 0; i < num_corpos; i++) grafo_incluir_chamadas(corpos[i].id_grafo, &corpos[i].chamadas);
+    sem_emitir_diagnosticos();
+    sem_liberar();
 }
\ No newline at end of file
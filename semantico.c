@@ -0,0 +1,368 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <limits.h>
+#include "semantico.h"
+
+/* Escopo: tabela hash endereçada pelo endereço do nome internado. Os baldes
+   só são alocados na primeira declaração (a maioria dos blocos não declara). */
+struct TEscopo {
+    TEscopo *pai;
+    TSimbolo *ultimo;          /* símbolos em ordem inversa de declaração */
+    TSimbolo **baldes;
+    int num_baldes;
+    int qtd;
+    TEscopo *retido;           /* lista dos escopos mantidos da thread principal */
+};
+
+/* Estado por thread: a thread principal declara (e retém) os escopos globais
+   e de cabeçalho; cada thread de verificação cria e libera só os dos blocos */
+static _Thread_local TEscopo *atual = NULL;
+static _Thread_local int limite = INT_MAX;    /* maior ordem visível (retrato do corpo) */
+static _Thread_local int reter_escopos = 1;
+
+static TEscopo *retidos = NULL;
+static int total_declarados = 0;
+
+static TDiagnosticos diag_declaracoes;
+static _Thread_local TDiagnosticos *diag_atual = &diag_declaracoes;
+static TDiagnosticos **buffers = NULL;        /* ordem de criação = ordem dos corpos no fonte */
+static int num_buffers = 0;
+static int total_erros = 0;
+
+void* sem_alocar(void *p, size_t tam) {
+    void *novo = realloc(p, tam);
+    if (!novo) {
+        perror("Erro de memória");
+        exit(1);
+    }
+    return novo;
+}
+
+/* Depósito de lexemas em blocos que nunca mudam de lugar, com tabela de
+   endereçamento aberto para achar a cópia já internada */
+#define TAM_BLOCO_CADEIAS 65536
+
+static char *bloco_cadeias = NULL;
+static size_t livre_bloco = 0;
+static const char **internados = NULL;
+static size_t num_internados = 0, cap_internados = 0;
+
+static size_t hash_cadeia(const char *s) {
+    size_t h = 2166136261u;
+    while (*s) h = (h ^ (unsigned char)*s++) * 16777619u;
+    return h;
+}
+
+static const char* guardar_cadeia(const char *lexema) {
+    size_t tam = strlen(lexema) + 1;
+    if (tam > livre_bloco) {
+        bloco_cadeias = sem_alocar(NULL, TAM_BLOCO_CADEIAS);
+        livre_bloco = TAM_BLOCO_CADEIAS;
+    }
+    char *copia = bloco_cadeias;
+    memcpy(copia, lexema, tam);
+    bloco_cadeias += tam;
+    livre_bloco -= tam;
+    return copia;
+}
+
+const char* sem_internar(const char *lexema) {
+    if (2 * (num_internados + 1) > cap_internados) {
+        size_t nova_cap = cap_internados ? 2 * cap_internados : 1024;
+        const char **nova = sem_alocar(NULL, nova_cap * sizeof(const char*));
+        memset(nova, 0, nova_cap * sizeof(const char*));
+        for (size_t i = 0; i < cap_internados; i++) {
+            if (!internados[i]) continue;
+            size_t j = hash_cadeia(internados[i]) & (nova_cap - 1);
+            while (nova[j]) j = (j + 1) & (nova_cap - 1);
+            nova[j] = internados[i];
+        }
+        free(internados);
+        internados = nova;
+        cap_internados = nova_cap;
+    }
+    size_t j = hash_cadeia(lexema) & (cap_internados - 1);
+    while (internados[j]) {
+        if (strcmp(internados[j], lexema) == 0) return internados[j];
+        j = (j + 1) & (cap_internados - 1);
+    }
+    num_internados++;
+    return internados[j] = guardar_cadeia(lexema);
+}
+
+static size_t balde(const TEscopo *e, const char *nome) {
+    return (((uintptr_t)nome >> 3) * 2654435761u) & (size_t)(e->num_baldes - 1);
+}
+
+/* dobra a tabela; percorrer 'ultimo' do mais novo ao mais antigo e inverter
+   cada balde mantém o mais novo à frente, como nas inserções */
+static void crescer_escopo(TEscopo *e) {
+    free(e->baldes);
+    e->num_baldes = e->num_baldes ? 2 * e->num_baldes : 8;
+    e->baldes = sem_alocar(NULL, (size_t)e->num_baldes * sizeof(TSimbolo*));
+    memset(e->baldes, 0, (size_t)e->num_baldes * sizeof(TSimbolo*));
+    for (TSimbolo *s = e->ultimo; s; s = s->anterior) {
+        size_t b = balde(e, s->nome);
+        s->colisao = e->baldes[b];
+        e->baldes[b] = s;
+    }
+    for (int b = 0; b < e->num_baldes; b++) {
+        TSimbolo *invertido = NULL, *s = e->baldes[b];
+        while (s) {
+            TSimbolo *prox = s->colisao;
+            s->colisao = invertido;
+            invertido = s;
+            s = prox;
+        }
+        e->baldes[b] = invertido;
+    }
+}
+
+static TSimbolo* buscar_no_escopo(const TEscopo *e, const char *nome) {
+    if (!e->baldes) return NULL;
+    for (TSimbolo *s = e->baldes[balde(e, nome)]; s; s = s->colisao) {
+        if (s->nome == nome && s->ordem <= limite) return s;
+    }
+    return NULL;
+}
+
+static void liberar_escopo(TEscopo *e) {
+    while (e->ultimo) {
+        TSimbolo *s = e->ultimo;
+        e->ultimo = s->anterior;
+        free(s->tipos_params);
+        free(s);
+    }
+    free(e->baldes);
+    free(e);
+}
+
+void sem_abrir_escopo(void) {
+    TEscopo *e = sem_alocar(NULL, sizeof(TEscopo));
+    memset(e, 0, sizeof(TEscopo));
+    e->pai = atual;
+    if (reter_escopos) {
+        e->retido = retidos;
+        retidos = e;
+    }
+    atual = e;
+}
+
+void sem_fechar_escopo(void) {
+    TEscopo *e = atual;
+    atual = e->pai;
+    if (!reter_escopos) liberar_escopo(e);
+}
+
+TEscopo* sem_escopo_atual(void) { return atual; }
+int sem_total_declarados(void) { return total_declarados; }
+
+void sem_restaurar_escopo(TEscopo *escopo, int limite_corpo) {
+    atual = escopo;
+    limite = limite_corpo;
+    reter_escopos = 0;
+}
+
+void sem_liberar(void) {
+    while (retidos) {
+        TEscopo *e = retidos;
+        retidos = e->retido;
+        liberar_escopo(e);
+    }
+}
+
+TSimbolo* sem_declarar(const char *nome, TCategoria cat, int linha) {
+    TSimbolo *anterior = buscar_no_escopo(atual, nome);
+    if (anterior) {
+        erro_semantico(linha, "'%s' já declarado neste escopo (linha %d)", nome, anterior->linha);
+    }
+
+    TSimbolo *novo = sem_alocar(NULL, sizeof(TSimbolo));
+    memset(novo, 0, sizeof(TSimbolo));
+    novo->nome = nome;
+    novo->categoria = cat;
+    novo->linha = linha;
+    novo->ordem = reter_escopos ? ++total_declarados : 0;
+    novo->tipo = TIPO_ERRO;
+
+    if (atual->qtd >= atual->num_baldes) crescer_escopo(atual);
+    size_t b = balde(atual, nome);
+    novo->colisao = atual->baldes[b];
+    atual->baldes[b] = novo;
+    novo->anterior = atual->ultimo;
+    atual->ultimo = novo;
+    atual->qtd++;
+    return novo;
+}
+
+TSimbolo* sem_buscar(const char *nome) {
+    for (const TEscopo *e = atual; e; e = e->pai) {
+        TSimbolo *s = buscar_no_escopo(e, nome);
+        if (s) return s;
+    }
+    return NULL;
+}
+
+void sem_adicionar_param(TSimbolo *sub, TTipo tipo) {
+    sub->tipos_params = sem_alocar(sub->tipos_params, (size_t)(sub->num_params + 1) * sizeof(TTipo));
+    sub->tipos_params[sub->num_params++] = tipo;
+}
+
+void sem_tipar_ultimos(int qtd, TTipo tipo) {
+    TSimbolo *s = atual->ultimo;
+    for (int i = 0; i < qtd && s; i++, s = s->anterior) {
+        s->tipo = tipo;
+    }
+}
+
+const char* sem_nome_tipo(TTipo tipo) {
+    switch (tipo) {
+        case TIPO_INT:    return "int";
+        case TIPO_FLOAT:  return "float";
+        case TIPO_CHAR:   return "char";
+        case TIPO_VOID:   return "void";
+        case TIPO_STRING: return "string";
+        default:          return "?";
+    }
+}
+
+static int eh_numerico(TTipo t) { return t == TIPO_INT || t == TIPO_FLOAT; }
+
+/* lado int de uma operação entre int e float, convertido para float */
+static TConversao conversao_mista(TTipo esq, TTipo dir) {
+    if (esq == TIPO_INT && dir == TIPO_FLOAT) return CONV_ESQ;
+    if (esq == TIPO_FLOAT && dir == TIPO_INT) return CONV_DIR;
+    return CONV_NENHUMA;
+}
+
+/* + - * / : int op int -> int; com algum float o int é convertido para float */
+TTipo sem_tipo_aritmetico(TTipo esq, TTipo dir, const char *op, int linha, TConversao *conv) {
+    *conv = CONV_NENHUMA;
+    if (esq == TIPO_ERRO || dir == TIPO_ERRO) return TIPO_ERRO;
+    if (!eh_numerico(esq) || !eh_numerico(dir)) {
+        erro_semantico(linha, "operador '%s' inválido entre %s e %s",
+                       op, sem_nome_tipo(esq), sem_nome_tipo(dir));
+        return TIPO_ERRO;
+    }
+    *conv = conversao_mista(esq, dir);
+    return (esq == TIPO_FLOAT || dir == TIPO_FLOAT) ? TIPO_FLOAT : TIPO_INT;
+}
+
+/* == != < > <= >= : numéricos entre si (o int é convertido se o outro for
+   float) ou char com char; resultado lógico (int) */
+TTipo sem_tipo_relacional(TTipo esq, TTipo dir, const char *op, int linha, TConversao *conv) {
+    *conv = CONV_NENHUMA;
+    if (esq == TIPO_ERRO || dir == TIPO_ERRO) return TIPO_ERRO;
+    if ((eh_numerico(esq) && eh_numerico(dir)) || (esq == TIPO_CHAR && dir == TIPO_CHAR)) {
+        *conv = conversao_mista(esq, dir);
+        return TIPO_INT;
+    }
+    erro_semantico(linha, "operador '%s' inválido entre %s e %s",
+                   op, sem_nome_tipo(esq), sem_nome_tipo(dir));
+    return TIPO_ERRO;
+}
+
+/* and or not : operandos lógicos (int); em 'not' esq == dir */
+TTipo sem_tipo_logico(TTipo esq, TTipo dir, const char *op, int linha) {
+    if (esq == TIPO_ERRO || dir == TIPO_ERRO) return TIPO_ERRO;
+    if (esq != TIPO_INT || dir != TIPO_INT) {
+        erro_semantico(linha, "operador '%s' exige operandos lógicos (int), encontrou %s e %s",
+                       op, sem_nome_tipo(esq), sem_nome_tipo(dir));
+        return TIPO_ERRO;
+    }
+    return TIPO_INT;
+}
+
+int sem_verificar_valor(TTipo tipo, const char *contexto, int linha) {
+    if (tipo == TIPO_ERRO) return 0;
+    if (tipo == TIPO_VOID) {
+        erro_semantico(linha, "%s: subrotina void não produz valor", contexto);
+        return 0;
+    }
+    return 1;
+}
+
+TConversao sem_verificar_atrib(TTipo destino, TTipo origem, const char *contexto, int linha) {
+    if (destino == TIPO_ERRO || !sem_verificar_valor(origem, contexto, linha)) return CONV_NENHUMA;
+    if (destino == TIPO_FLOAT && origem == TIPO_INT) return CONV_DIR;
+    if (destino != origem) {
+        erro_semantico(linha, "%s: esperado %s, encontrou %s",
+                       contexto, sem_nome_tipo(destino), sem_nome_tipo(origem));
+    }
+    return CONV_NENHUMA;
+}
+
+void sem_verificar_condicao(TTipo tipo, int linha) {
+    if (tipo != TIPO_ERRO && tipo != TIPO_INT) {
+        erro_semantico(linha, "condição deve ser lógica (int), encontrou %s", sem_nome_tipo(tipo));
+    }
+}
+
+void erro_semantico(int linha, const char *fmt, ...) {
+    char msg[2 * MAX_LEXEMA + 128];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, args);
+    va_end(args);
+
+    TDiagnosticos *d = diag_atual;
+    d->itens = sem_alocar(d->itens, (size_t)(d->qtd + 1) * sizeof(TDiagnostico));
+    d->itens[d->qtd].linha = linha;
+    d->itens[d->qtd].msg = sem_alocar(NULL, strlen(msg) + 1);
+    strcpy(d->itens[d->qtd].msg, msg);
+    d->qtd++;
+}
+
+TDiagnosticos* sem_novo_buffer(void) {
+    TDiagnosticos *d = sem_alocar(NULL, sizeof(TDiagnosticos));
+    memset(d, 0, sizeof(TDiagnosticos));
+    if ((num_buffers & (num_buffers - 1)) == 0) {   /* capacidade dobra nas potências de 2 */
+        buffers = sem_alocar(buffers, (size_t)(num_buffers ? 2 * num_buffers : 1) * sizeof(TDiagnosticos*));
+    }
+    buffers[num_buffers++] = d;
+    return d;
+}
+
+void sem_usar_diagnosticos(TDiagnosticos *buf) {
+    diag_atual = buf ? buf : &diag_declaracoes;
+}
+
+/* ordena por linha; no empate vale a ordem de coleta (buffer, depois posição) */
+typedef struct { const TDiagnostico *d; int ordem; } TIntercalado;
+
+static int comparar_diagnosticos(const void *a, const void *b) {
+    const TIntercalado *x = a, *y = b;
+    if (x->d->linha != y->d->linha) return x->d->linha < y->d->linha ? -1 : 1;
+    return (x->ordem > y->ordem) - (x->ordem < y->ordem);
+}
+
+void sem_emitir_diagnosticos(void) {
+    int total = diag_declaracoes.qtd;
+    for (int i = 0; i < num_buffers; i++) total += buffers[i]->qtd;
+    if (total == 0) return;
+
+    TIntercalado *todos = sem_alocar(NULL, (size_t)total * sizeof(TIntercalado));
+    int n = 0;
+    for (int j = 0; j < diag_declaracoes.qtd; j++, n++) {
+        todos[n].d = &diag_declaracoes.itens[j];
+        todos[n].ordem = n;
+    }
+    for (int i = 0; i < num_buffers; i++) {
+        for (int j = 0; j < buffers[i]->qtd; j++, n++) {
+            todos[n].d = &buffers[i]->itens[j];
+            todos[n].ordem = n;
+        }
+    }
+    qsort(todos, (size_t)total, sizeof(TIntercalado), comparar_diagnosticos);
+
+    for (int i = 0; i < total; i++) {
+        fprintf(stderr, "[ERRO SEMÂNTICO] Linha %d: %s\n", todos[i].d->linha, todos[i].d->msg);
+    }
+    total_erros += total;
+    free(todos);
+}
+
+int sem_total_erros(void) {
+    return total_erros;
+}
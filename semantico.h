@@ -0,0 +1,104 @@
+#ifndef SEMANTICO_H
+#define SEMANTICO_H
+
+#include "scanner.h"
+
+// Tipo estático de declarações e expressões
+typedef enum {
+    TIPO_INT, TIPO_FLOAT, TIPO_CHAR, TIPO_VOID,
+    TIPO_STRING,   // só literais "..."
+    TIPO_ERRO      // já diagnosticado; não gera erros em cascata
+} TTipo;
+
+// Categoria de um identificador declarado
+typedef enum {
+    CAT_VAR, CAT_PARAM, CAT_SUBROT
+} TCategoria;
+
+// Entrada da tabela de símbolos
+typedef struct TSimbolo {
+    const char *nome;   // internado: nomes iguais têm o mesmo endereço
+    TCategoria categoria;
+    int linha;
+    int ordem;          // nº de declaração na thread principal (0: local de um corpo)
+    TTipo tipo;         // tipo da variável/parâmetro ou retorno da subrotina
+    int num_params;     // só para CAT_SUBROT
+    TTipo *tipos_params;
+    int id_grafo;       // nó no grafo de chamadas (CAT_SUBROT)
+    struct TSimbolo *anterior;   // declarado antes no mesmo escopo
+    struct TSimbolo *colisao;    // próximo no mesmo balde da tabela hash
+} TSimbolo;
+
+// Escopo com tabela hash própria, encadeado ao escopo envolvente
+typedef struct TEscopo TEscopo;
+
+// Diagnósticos de uma unidade de análise (declarações ou um corpo de subrotina)
+typedef struct {
+    int linha;
+    char *msg;
+} TDiagnostico;
+
+typedef struct {
+    TDiagnostico *itens;
+    int qtd;
+} TDiagnosticos;
+
+// realloc que encerra o compilador (código 1) se faltar memória
+void* sem_alocar(void *p, size_t tam);
+
+// Cópia única do lexema num depósito de cadeias; só a thread principal interna
+const char* sem_internar(const char *lexema);
+
+// Escopos aninhados (programa, subrotinas, blocos)
+void sem_abrir_escopo(void);
+void sem_fechar_escopo(void);
+
+// Os escopos da thread principal são mantidos até sem_liberar. O escopo atual e
+// o nº de símbolos já declarados no início de um corpo formam um retrato
+// congelado: a thread que verifica o corpo só enxerga símbolos com ordem <= limite.
+TEscopo* sem_escopo_atual(void);
+int sem_total_declarados(void);
+void sem_restaurar_escopo(TEscopo *escopo, int limite);   // início de um corpo numa thread
+void sem_liberar(void);
+
+// Declara 'nome' (internado) no escopo atual; acusa redeclaração mas sempre
+// insere o símbolo, que passa a ser o visível
+TSimbolo* sem_declarar(const char *nome, TCategoria cat, int linha);
+
+// Busca do escopo mais interno para o mais externo (NULL se não achar)
+TSimbolo* sem_buscar(const char *nome);
+
+// Tipagem das declarações
+void sem_adicionar_param(TSimbolo *sub, TTipo tipo);
+void sem_tipar_ultimos(int qtd, TTipo tipo);   // forma "id, id : tipo"
+
+// Conversão int -> float implícita: qual operando (ou o valor atribuído) vira float
+typedef enum {
+    CONV_NENHUMA, CONV_ESQ, CONV_DIR
+} TConversao;
+
+// Inferência de tipos das expressões (TIPO_ERRO se o uso for inválido); 'conv'
+// recebe a conversão que o operador exige entre int e float
+const char* sem_nome_tipo(TTipo tipo);
+TTipo sem_tipo_aritmetico(TTipo esq, TTipo dir, const char *op, int linha, TConversao *conv);
+TTipo sem_tipo_relacional(TTipo esq, TTipo dir, const char *op, int linha, TConversao *conv);
+TTipo sem_tipo_logico(TTipo esq, TTipo dir, const char *op, int linha);
+
+// Valor usado em 'contexto' (write, atribuição, argumento, return): o resultado
+// de subrotina void não tem valor. Devolve 0 se o valor não pode ser usado.
+int sem_verificar_valor(TTipo tipo, const char *contexto, int linha);
+
+// Valor do tipo 'origem' usado onde se espera 'destino'; devolve CONV_DIR se
+// 'origem' int é convertida para float
+TConversao sem_verificar_atrib(TTipo destino, TTipo origem, const char *contexto, int linha);
+void sem_verificar_condicao(TTipo tipo, int linha);
+
+// Diagnósticos semânticos não abortam a análise; cada thread escreve no buffer
+// selecionado e sem_emitir_diagnosticos intercala todos pela linha do fonte
+void erro_semantico(int linha, const char *fmt, ...);
+TDiagnosticos* sem_novo_buffer(void);
+void sem_usar_diagnosticos(TDiagnosticos *buf);
+void sem_emitir_diagnosticos(void);
+int sem_total_erros(void);
+
+#endif
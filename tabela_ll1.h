@@ -0,0 +1,510 @@
+/* Gerado por gramatica.c (./gerar_tabela > tabela_ll1.h) -- não editar. */
+#ifndef TABELA_LL1_H
+#define TABELA_LL1_H
+
+#include "scanner.h"
+
+/* Terminais; 'lexema' só nos átomos divididos por lexema */
+typedef struct { TAtomo atomo; const char *lexema; const char *nome; } TTerminalLL1;
+
+#define NUM_TERMINAIS_LL1 40
+static const TTerminalLL1 terminais_ll1[NUM_TERMINAIS_LL1] = {
+    /*  0 */ { T_FIM, NULL, "$" },
+    /*  1 */ { T_PRG, NULL, "prg" },
+    /*  2 */ { T_VAR, NULL, "var" },
+    /*  3 */ { T_SUBROT, NULL, "subrot" },
+    /*  4 */ { T_INT, NULL, "int" },
+    /*  5 */ { T_FLOAT, NULL, "float" },
+    /*  6 */ { T_CHAR, NULL, "char" },
+    /*  7 */ { T_VOID, NULL, "void" },
+    /*  8 */ { T_READ, NULL, "read" },
+    /*  9 */ { T_WRITE, NULL, "write" },
+    /* 10 */ { T_IF, NULL, "if" },
+    /* 11 */ { T_THEN, NULL, "then" },
+    /* 12 */ { T_ELSE, NULL, "else" },
+    /* 13 */ { T_FOR, NULL, "for" },
+    /* 14 */ { T_WHILE, NULL, "while" },
+    /* 15 */ { T_REPEAT, NULL, "repeat" },
+    /* 16 */ { T_UNTIL, NULL, "until" },
+    /* 17 */ { T_BEGIN, NULL, "begin" },
+    /* 18 */ { T_END, NULL, "end" },
+    /* 19 */ { T_RETURN, NULL, "return" },
+    /* 20 */ { T_ID, NULL, "ID" },
+    /* 21 */ { T_LITERAL_INT, NULL, "LIT_INT" },
+    /* 22 */ { T_LITERAL_FLOAT, NULL, "LIT_FLOAT" },
+    /* 23 */ { T_LITERAL_CHAR, NULL, "LIT_CHAR" },
+    /* 24 */ { T_LITERAL_STRING, NULL, "LIT_STRING" },
+    /* 25 */ { T_OP_ATRIB, NULL, "<-" },
+    /* 26 */ { T_OP_ARIT, "+", "+" },
+    /* 27 */ { T_OP_ARIT, "-", "-" },
+    /* 28 */ { T_OP_ARIT, "*", "*" },
+    /* 29 */ { T_OP_ARIT, "/", "/" },
+    /* 30 */ { T_OP_REL, NULL, "OP_REL" },
+    /* 31 */ { T_OP_LOG, "and", "and" },
+    /* 32 */ { T_OP_LOG, "or", "or" },
+    /* 33 */ { T_OP_LOG, "not", "not" },
+    /* 34 */ { T_DELIM, "(", "(" },
+    /* 35 */ { T_DELIM, ")", ")" },
+    /* 36 */ { T_DELIM, ",", "," },
+    /* 37 */ { T_DELIM, ";", ";" },
+    /* 38 */ { T_DELIM, ".", "." },
+    /* 39 */ { T_DELIM, ":", ":" },
+};
+
+enum {
+    NT_PROGRAMA,
+    NT_SECAO_VAR,
+    NT_SUBROTINAS,
+    NT_CORPO,
+    NT_BLOCO,
+    NT_DECL_VAR,
+    NT_DECLS_VAR,
+    NT_TIPO,
+    NT_VARS_TIPADAS,
+    NT_IDS,
+    NT_SUBROTINA,
+    NT_CABECALHO,
+    NT_PV_OPT,
+    NT_PARAMETROS,
+    NT_RETORNO,
+    NT_PARAMS_TIPO,
+    NT_IDS_PARAM,
+    NT_DECLS_LOCAIS,
+    NT_COMANDOS,
+    NT_DECL_LOCAL,
+    NT_COMANDO,
+    NT_SEPARADOR,
+    NT_RESTO_ID,
+    NT_CMD_READ,
+    NT_CMD_WRITE,
+    NT_CMD_RETURN,
+    NT_CMD_IF,
+    NT_CMD_WHILE,
+    NT_CMD_FOR,
+    NT_CMD_REPEAT,
+    NT_EXPRESSAO,
+    NT_CHAMADA,
+    NT_SENAO,
+    NT_ATRIB_OPT,
+    NT_LIDOS,
+    NT_ITEM_WRITE,
+    NT_ITENS_WRITE,
+    NT_RETORNO_EXPR,
+    NT_EXPR_REL,
+    NT_EXPR_LOG,
+    NT_EXPR_ARIT,
+    NT_REL_OPT,
+    NT_TERMO,
+    NT_SOMA,
+    NT_FATOR,
+    NT_PRODUTO,
+    NT_CHAMADA_OPT,
+    NT_ARGUMENTOS,
+    NT_MAIS_ARGS,
+    NUM_NAO_TERMINAIS_LL1
+};
+
+/* Ações semânticas, executadas por parser.c */
+enum {
+    ACAO_PROGRAMA,
+    ACAO_FIM_SUBROT,
+    ACAO_DADO,
+    ACAO_VAR,
+    ACAO_DESCARTAR,
+    ACAO_CONTAR,
+    ACAO_VAR_SEM_TIPO,
+    ACAO_TIPAR,
+    ACAO_TIPO,
+    ACAO_SUBROT,
+    ACAO_SEM_TIPO,
+    ACAO_RETORNO,
+    ACAO_PARAM,
+    ACAO_PARAM_SEM_TIPO,
+    ACAO_TIPAR_PARAMS,
+    ACAO_ABRIR_ESCOPO,
+    ACAO_FECHAR_ESCOPO,
+    ACAO_NOME,
+    ACAO_VARIAVEL,
+    ACAO_ATRIBUICAO,
+    ACAO_LINHA,
+    ACAO_CONDICAO,
+    ACAO_LACO,
+    ACAO_FIM_LACO,
+    ACAO_LER,
+    ACAO_ESCRITO,
+    ACAO_RETORNO_VALOR,
+    ACAO_RETORNO_VAZIO,
+    ACAO_OP,
+    ACAO_LOGICO,
+    ACAO_RELACIONAL,
+    ACAO_ARITMETICO,
+    ACAO_NAO,
+    ACAO_LITERAL,
+    ACAO_VALOR,
+    ACAO_CHAMADA,
+    ACAO_FIM_CHAMADA,
+    ACAO_ARGUMENTO,
+    NUM_ACOES_LL1
+};
+
+/* Símbolo na pilha: terminal, não-terminal ou ação */
+#define SIMB_NT(n) (NUM_TERMINAIS_LL1 + (n))
+#define SIMB_ACAO(a) (NUM_TERMINAIS_LL1 + NUM_NAO_TERMINAIS_LL1 + (a))
+
+/* Corpo da produção p, invertido (pronto para empilhar):
+   simbolos_ll1[inicio_producao_ll1[p] .. inicio_producao_ll1[p+1]) */
+#define NUM_PRODUCOES_LL1 100
+static const short simbolos_ll1[] = {
+    /*  0: programa -> prg ID ; @programa secao_var subrotinas corpo @fim_subrot . */
+    38, SIMB_ACAO(ACAO_FIM_SUBROT), SIMB_NT(NT_CORPO), SIMB_NT(NT_SUBROTINAS), SIMB_NT(NT_SECAO_VAR), SIMB_ACAO(ACAO_PROGRAMA), 37, 20, 1,
+    /*  1: corpo -> bloco */
+    SIMB_NT(NT_BLOCO),
+    /*  2: secao_var -> var decl_var ; decls_var */
+    SIMB_NT(NT_DECLS_VAR), 37, SIMB_NT(NT_DECL_VAR), 2,
+    /*  3: secao_var -> decls_var */
+    SIMB_NT(NT_DECLS_VAR),
+    /*  4: decls_var -> decl_var ; decls_var */
+    SIMB_NT(NT_DECLS_VAR), 37, SIMB_NT(NT_DECL_VAR),
+    /*  5: decls_var -> ε */
+    /*  6: decl_var -> tipo @dado ID @var vars_tipadas @descartar */
+    SIMB_ACAO(ACAO_DESCARTAR), SIMB_NT(NT_VARS_TIPADAS), SIMB_ACAO(ACAO_VAR), 20, SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO),
+    /*  7: decl_var -> @contar ID @var_sem_tipo ids : tipo @dado @tipar */
+    SIMB_ACAO(ACAO_TIPAR), SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO), 39, SIMB_NT(NT_IDS), SIMB_ACAO(ACAO_VAR_SEM_TIPO), 20, SIMB_ACAO(ACAO_CONTAR),
+    /*  8: vars_tipadas -> , ID @var vars_tipadas */
+    SIMB_NT(NT_VARS_TIPADAS), SIMB_ACAO(ACAO_VAR), 20, 36,
+    /*  9: vars_tipadas -> ε */
+    /* 10: ids -> , ID @var_sem_tipo ids */
+    SIMB_NT(NT_IDS), SIMB_ACAO(ACAO_VAR_SEM_TIPO), 20, 36,
+    /* 11: ids -> ε */
+    /* 12: tipo -> int @tipo */
+    SIMB_ACAO(ACAO_TIPO), 4,
+    /* 13: tipo -> float @tipo */
+    SIMB_ACAO(ACAO_TIPO), 5,
+    /* 14: tipo -> char @tipo */
+    SIMB_ACAO(ACAO_TIPO), 6,
+    /* 15: tipo -> void @tipo */
+    SIMB_ACAO(ACAO_TIPO), 7,
+    /* 16: subrotinas -> subrotina subrotinas */
+    SIMB_NT(NT_SUBROTINAS), SIMB_NT(NT_SUBROTINA),
+    /* 17: subrotinas -> ε */
+    /* 18: subrotina -> subrot cabecalho pv_opt secao_var subrotinas corpo @fim_subrot pv_opt */
+    SIMB_NT(NT_PV_OPT), SIMB_ACAO(ACAO_FIM_SUBROT), SIMB_NT(NT_CORPO), SIMB_NT(NT_SUBROTINAS), SIMB_NT(NT_SECAO_VAR), SIMB_NT(NT_PV_OPT), SIMB_NT(NT_CABECALHO), 3,
+    /* 19: cabecalho -> tipo ID @subrot ( parametros ) */
+    35, SIMB_NT(NT_PARAMETROS), 34, SIMB_ACAO(ACAO_SUBROT), 20, SIMB_NT(NT_TIPO),
+    /* 20: cabecalho -> @sem_tipo ID @subrot ( parametros ) retorno */
+    SIMB_NT(NT_RETORNO), 35, SIMB_NT(NT_PARAMETROS), 34, SIMB_ACAO(ACAO_SUBROT), 20, SIMB_ACAO(ACAO_SEM_TIPO),
+    /* 21: retorno -> : tipo @retorno */
+    SIMB_ACAO(ACAO_RETORNO), SIMB_NT(NT_TIPO), 39,
+    /* 22: retorno -> ε */
+    /* 23: pv_opt -> ; */
+    37,
+    /* 24: pv_opt -> ε */
+    /* 25: parametros -> tipo @dado ID @param params_tipo */
+    SIMB_NT(NT_PARAMS_TIPO), SIMB_ACAO(ACAO_PARAM), 20, SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO),
+    /* 26: parametros -> @contar ID @param_sem_tipo ids_param : tipo @dado @tipar_params */
+    SIMB_ACAO(ACAO_TIPAR_PARAMS), SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO), 39, SIMB_NT(NT_IDS_PARAM), SIMB_ACAO(ACAO_PARAM_SEM_TIPO), 20, SIMB_ACAO(ACAO_CONTAR),
+    /* 27: parametros -> ε */
+    /* 28: params_tipo -> , tipo @dado ID @param params_tipo */
+    SIMB_NT(NT_PARAMS_TIPO), SIMB_ACAO(ACAO_PARAM), 20, SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO), 36,
+    /* 29: params_tipo -> ε */
+    /* 30: ids_param -> , ID @param_sem_tipo ids_param */
+    SIMB_NT(NT_IDS_PARAM), SIMB_ACAO(ACAO_PARAM_SEM_TIPO), 20, 36,
+    /* 31: ids_param -> ε */
+    /* 32: bloco -> begin @abrir_escopo decls_locais comandos @fechar_escopo end */
+    18, SIMB_ACAO(ACAO_FECHAR_ESCOPO), SIMB_NT(NT_COMANDOS), SIMB_NT(NT_DECLS_LOCAIS), SIMB_ACAO(ACAO_ABRIR_ESCOPO), 17,
+    /* 33: decls_locais -> decl_local ; decls_locais */
+    SIMB_NT(NT_DECLS_LOCAIS), 37, SIMB_NT(NT_DECL_LOCAL),
+    /* 34: decls_locais -> ε */
+    /* 35: decl_local -> tipo @dado ID @var vars_tipadas @descartar */
+    SIMB_ACAO(ACAO_DESCARTAR), SIMB_NT(NT_VARS_TIPADAS), SIMB_ACAO(ACAO_VAR), 20, SIMB_ACAO(ACAO_DADO), SIMB_NT(NT_TIPO),
+    /* 36: comandos -> comando separador comandos */
+    SIMB_NT(NT_COMANDOS), SIMB_NT(NT_SEPARADOR), SIMB_NT(NT_COMANDO),
+    /* 37: comandos -> ε */
+    /* 38: separador -> ; separador */
+    SIMB_NT(NT_SEPARADOR), 37,
+    /* 39: separador -> ε */
+    /* 40: comando -> ID @nome resto_id */
+    SIMB_NT(NT_RESTO_ID), SIMB_ACAO(ACAO_NOME), 20,
+    /* 41: comando -> cmd_read */
+    SIMB_NT(NT_CMD_READ),
+    /* 42: comando -> cmd_write */
+    SIMB_NT(NT_CMD_WRITE),
+    /* 43: comando -> cmd_return */
+    SIMB_NT(NT_CMD_RETURN),
+    /* 44: comando -> bloco */
+    SIMB_NT(NT_BLOCO),
+    /* 45: comando -> cmd_if */
+    SIMB_NT(NT_CMD_IF),
+    /* 46: comando -> cmd_while */
+    SIMB_NT(NT_CMD_WHILE),
+    /* 47: comando -> cmd_for */
+    SIMB_NT(NT_CMD_FOR),
+    /* 48: comando -> cmd_repeat */
+    SIMB_NT(NT_CMD_REPEAT),
+    /* 49: resto_id -> @variavel <- expressao @atribuicao */
+    SIMB_ACAO(ACAO_ATRIBUICAO), SIMB_NT(NT_EXPRESSAO), 25, SIMB_ACAO(ACAO_VARIAVEL),
+    /* 50: resto_id -> chamada @descartar */
+    SIMB_ACAO(ACAO_DESCARTAR), SIMB_NT(NT_CHAMADA),
+    /* 51: cmd_if -> if ( @linha expressao @condicao ) then comando senao */
+    SIMB_NT(NT_SENAO), SIMB_NT(NT_COMANDO), 11, 35, SIMB_ACAO(ACAO_CONDICAO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA), 34, 10,
+    /* 52: senao -> else comando */
+    SIMB_NT(NT_COMANDO), 12,
+    /* 53: senao -> ε */
+    /* 54: cmd_while -> while ( @laco @linha expressao @condicao ) comando @fim_laco */
+    SIMB_ACAO(ACAO_FIM_LACO), SIMB_NT(NT_COMANDO), 35, SIMB_ACAO(ACAO_CONDICAO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA), SIMB_ACAO(ACAO_LACO), 34, 14,
+    /* 55: cmd_for -> for ( atrib_opt ; @laco @linha expressao @condicao ; atrib_opt ) comando @fim_laco */
+    SIMB_ACAO(ACAO_FIM_LACO), SIMB_NT(NT_COMANDO), 35, SIMB_NT(NT_ATRIB_OPT), 37, SIMB_ACAO(ACAO_CONDICAO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA), SIMB_ACAO(ACAO_LACO), 37, SIMB_NT(NT_ATRIB_OPT), 34, 13,
+    /* 56: atrib_opt -> ID @nome @variavel <- expressao @atribuicao */
+    SIMB_ACAO(ACAO_ATRIBUICAO), SIMB_NT(NT_EXPRESSAO), 25, SIMB_ACAO(ACAO_VARIAVEL), SIMB_ACAO(ACAO_NOME), 20,
+    /* 57: atrib_opt -> ε */
+    /* 58: cmd_repeat -> repeat @laco comando until ( @linha expressao @condicao ) @fim_laco */
+    SIMB_ACAO(ACAO_FIM_LACO), 35, SIMB_ACAO(ACAO_CONDICAO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA), 34, 16, SIMB_NT(NT_COMANDO), SIMB_ACAO(ACAO_LACO), 15,
+    /* 59: cmd_read -> read ( ID @ler lidos ) */
+    35, SIMB_NT(NT_LIDOS), SIMB_ACAO(ACAO_LER), 20, 34, 8,
+    /* 60: lidos -> , ID @ler lidos */
+    SIMB_NT(NT_LIDOS), SIMB_ACAO(ACAO_LER), 20, 36,
+    /* 61: lidos -> ε */
+    /* 62: cmd_write -> write ( item_write itens_write ) */
+    35, SIMB_NT(NT_ITENS_WRITE), SIMB_NT(NT_ITEM_WRITE), 34, 9,
+    /* 63: itens_write -> , item_write itens_write */
+    SIMB_NT(NT_ITENS_WRITE), SIMB_NT(NT_ITEM_WRITE), 36,
+    /* 64: itens_write -> ε */
+    /* 65: item_write -> LIT_STRING */
+    24,
+    /* 66: item_write -> LIT_CHAR */
+    23,
+    /* 67: item_write -> @linha expressao @escrito */
+    SIMB_ACAO(ACAO_ESCRITO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA),
+    /* 68: cmd_return -> @linha return retorno_expr */
+    SIMB_NT(NT_RETORNO_EXPR), 19, SIMB_ACAO(ACAO_LINHA),
+    /* 69: retorno_expr -> expressao @retorno_valor */
+    SIMB_ACAO(ACAO_RETORNO_VALOR), SIMB_NT(NT_EXPRESSAO),
+    /* 70: retorno_expr -> @retorno_vazio */
+    SIMB_ACAO(ACAO_RETORNO_VAZIO),
+    /* 71: expressao -> expr_rel expr_log */
+    SIMB_NT(NT_EXPR_LOG), SIMB_NT(NT_EXPR_REL),
+    /* 72: expr_log -> and @op expr_rel @logico expr_log */
+    SIMB_NT(NT_EXPR_LOG), SIMB_ACAO(ACAO_LOGICO), SIMB_NT(NT_EXPR_REL), SIMB_ACAO(ACAO_OP), 31,
+    /* 73: expr_log -> or @op expr_rel @logico expr_log */
+    SIMB_NT(NT_EXPR_LOG), SIMB_ACAO(ACAO_LOGICO), SIMB_NT(NT_EXPR_REL), SIMB_ACAO(ACAO_OP), 32,
+    /* 74: expr_log -> ε */
+    /* 75: expr_rel -> expr_arit rel_opt */
+    SIMB_NT(NT_REL_OPT), SIMB_NT(NT_EXPR_ARIT),
+    /* 76: rel_opt -> OP_REL @op expr_arit @relacional */
+    SIMB_ACAO(ACAO_RELACIONAL), SIMB_NT(NT_EXPR_ARIT), SIMB_ACAO(ACAO_OP), 30,
+    /* 77: rel_opt -> ε */
+    /* 78: expr_arit -> termo soma */
+    SIMB_NT(NT_SOMA), SIMB_NT(NT_TERMO),
+    /* 79: soma -> + @op termo @aritmetico soma */
+    SIMB_NT(NT_SOMA), SIMB_ACAO(ACAO_ARITMETICO), SIMB_NT(NT_TERMO), SIMB_ACAO(ACAO_OP), 26,
+    /* 80: soma -> - @op termo @aritmetico soma */
+    SIMB_NT(NT_SOMA), SIMB_ACAO(ACAO_ARITMETICO), SIMB_NT(NT_TERMO), SIMB_ACAO(ACAO_OP), 27,
+    /* 81: soma -> ε */
+    /* 82: termo -> fator produto */
+    SIMB_NT(NT_PRODUTO), SIMB_NT(NT_FATOR),
+    /* 83: produto -> * @op fator @aritmetico produto */
+    SIMB_NT(NT_PRODUTO), SIMB_ACAO(ACAO_ARITMETICO), SIMB_NT(NT_FATOR), SIMB_ACAO(ACAO_OP), 28,
+    /* 84: produto -> / @op fator @aritmetico produto */
+    SIMB_NT(NT_PRODUTO), SIMB_ACAO(ACAO_ARITMETICO), SIMB_NT(NT_FATOR), SIMB_ACAO(ACAO_OP), 29,
+    /* 85: produto -> ε */
+    /* 86: fator -> ( expressao ) */
+    35, SIMB_NT(NT_EXPRESSAO), 34,
+    /* 87: fator -> not @op fator @nao */
+    SIMB_ACAO(ACAO_NAO), SIMB_NT(NT_FATOR), SIMB_ACAO(ACAO_OP), 33,
+    /* 88: fator -> ID @nome chamada_opt */
+    SIMB_NT(NT_CHAMADA_OPT), SIMB_ACAO(ACAO_NOME), 20,
+    /* 89: fator -> LIT_INT @literal */
+    SIMB_ACAO(ACAO_LITERAL), 21,
+    /* 90: fator -> LIT_FLOAT @literal */
+    SIMB_ACAO(ACAO_LITERAL), 22,
+    /* 91: fator -> LIT_CHAR @literal */
+    SIMB_ACAO(ACAO_LITERAL), 23,
+    /* 92: fator -> LIT_STRING @literal */
+    SIMB_ACAO(ACAO_LITERAL), 24,
+    /* 93: chamada_opt -> chamada */
+    SIMB_NT(NT_CHAMADA),
+    /* 94: chamada_opt -> @valor */
+    SIMB_ACAO(ACAO_VALOR),
+    /* 95: chamada -> @chamada ( argumentos ) @fim_chamada */
+    SIMB_ACAO(ACAO_FIM_CHAMADA), 35, SIMB_NT(NT_ARGUMENTOS), 34, SIMB_ACAO(ACAO_CHAMADA),
+    /* 96: argumentos -> @linha expressao @argumento mais_args */
+    SIMB_NT(NT_MAIS_ARGS), SIMB_ACAO(ACAO_ARGUMENTO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA),
+    /* 97: argumentos -> ε */
+    /* 98: mais_args -> , @linha expressao @argumento mais_args */
+    SIMB_NT(NT_MAIS_ARGS), SIMB_ACAO(ACAO_ARGUMENTO), SIMB_NT(NT_EXPRESSAO), SIMB_ACAO(ACAO_LINHA), 36,
+    /* 99: mais_args -> ε */
+};
+
+static const short inicio_producao_ll1[NUM_PRODUCOES_LL1 + 1] = {
+    0, 9, 10, 14, 15, 18, 18, 24, 32, 36, 36, 40, 40, 42, 44, 46,
+    48, 50, 50, 58, 64, 71, 74, 74, 75, 75, 80, 88, 88, 94, 94, 98,
+    98, 104, 107, 107, 113, 116, 116, 118, 118, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 133, 135, 144, 146, 146, 155, 168, 174, 174, 184, 190, 194, 194, 199,
+    202, 202, 203, 204, 207, 210, 212, 213, 215, 220, 225, 225, 227, 231, 231, 233,
+    238, 243, 243, 245, 250, 255, 255, 258, 262, 265, 267, 269, 271, 273, 274, 275,
+    280, 284, 284, 289, 289,
+};
+
+/* M[não-terminal][terminal]: produção a expandir; -1 = erro */
+static const signed char tabela_ll1[NUM_NAO_TERMINAIS_LL1][NUM_TERMINAIS_LL1] = {
+    /* programa */
+    {-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* secao_var */
+    {-1,-1,2,3,3,3,3,3,-1,-1,-1,-1,-1,-1,-1,-1,-1,3,-1,-1,3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* subrotinas */
+    {-1,-1,-1,16,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* corpo */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* bloco */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* decl_var */
+    {-1,-1,-1,-1,6,6,6,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* decls_var */
+    {-1,-1,-1,5,4,4,4,4,-1,-1,-1,-1,-1,-1,-1,-1,-1,5,-1,-1,4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* tipo */
+    {-1,-1,-1,-1,12,13,14,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* vars_tipadas */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,8,9,-1,-1},
+    /* ids */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,10,-1,-1,11},
+    /* subrotina */
+    {-1,-1,-1,18,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cabecalho */
+    {-1,-1,-1,-1,19,19,19,19,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,20,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* pv_opt */
+    {-1,-1,24,24,24,24,24,24,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,-1,-1,24,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,23,-1,-1},
+    /* parametros */
+    {-1,-1,-1,-1,25,25,25,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,27,-1,-1,-1,-1},
+    /* retorno */
+    {-1,-1,22,22,22,22,22,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,22,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,22,-1,21},
+    /* params_tipo */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,29,28,-1,-1,-1},
+    /* ids_param */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,31},
+    /* decls_locais */
+    {-1,-1,-1,-1,33,33,33,33,34,34,34,-1,-1,34,34,34,-1,34,34,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* comandos */
+    {-1,-1,-1,-1,-1,-1,-1,-1,36,36,36,-1,-1,36,36,36,-1,36,37,36,36,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* decl_local */
+    {-1,-1,-1,-1,35,35,35,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* comando */
+    {-1,-1,-1,-1,-1,-1,-1,-1,41,42,45,-1,-1,47,46,48,-1,44,-1,43,40,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* separador */
+    {-1,-1,-1,-1,-1,-1,-1,-1,39,39,39,-1,-1,39,39,39,-1,39,39,39,39,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,38,-1,-1},
+    /* resto_id */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,49,-1,-1,-1,-1,-1,-1,-1,-1,50,-1,-1,-1,-1,-1},
+    /* cmd_read */
+    {-1,-1,-1,-1,-1,-1,-1,-1,59,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_write */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,62,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_return */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,68,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_if */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_while */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,54,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_for */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,55,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* cmd_repeat */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,58,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+    /* expressao */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,71,71,71,71,71,-1,-1,-1,-1,-1,-1,-1,-1,71,71,-1,-1,-1,-1,-1},
+    /* chamada */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,95,-1,-1,-1,-1,-1},
+    /* senao */
+    {-1,-1,-1,-1,-1,-1,-1,-1,53,53,53,-1,52,53,53,53,53,53,53,53,53,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,53,-1,-1},
+    /* atrib_opt */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,56,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,57,-1,57,-1,-1},
+    /* lidos */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,61,60,-1,-1,-1},
+    /* item_write */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,67,67,67,66,65,-1,-1,-1,-1,-1,-1,-1,-1,67,67,-1,-1,-1,-1,-1},
+    /* itens_write */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,64,63,-1,-1,-1},
+    /* retorno_expr */
+    {-1,-1,-1,-1,-1,-1,-1,-1,70,70,70,-1,70,70,70,70,70,70,70,70,69,69,69,69,69,-1,-1,-1,-1,-1,-1,-1,-1,69,69,-1,-1,70,-1,-1},
+    /* expr_rel */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,75,75,75,75,75,-1,-1,-1,-1,-1,-1,-1,-1,75,75,-1,-1,-1,-1,-1},
+    /* expr_log */
+    {-1,-1,-1,-1,-1,-1,-1,-1,74,74,74,-1,74,74,74,74,74,74,74,74,74,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,72,73,-1,-1,74,74,74,-1,-1},
+    /* expr_arit */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,78,78,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,78,78,-1,-1,-1,-1,-1},
+    /* rel_opt */
+    {-1,-1,-1,-1,-1,-1,-1,-1,77,77,77,-1,77,77,77,77,77,77,77,77,77,-1,-1,-1,-1,-1,-1,-1,-1,-1,76,77,77,-1,-1,77,77,77,-1,-1},
+    /* termo */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,82,82,82,82,82,-1,-1,-1,-1,-1,-1,-1,-1,82,82,-1,-1,-1,-1,-1},
+    /* soma */
+    {-1,-1,-1,-1,-1,-1,-1,-1,81,81,81,-1,81,81,81,81,81,81,81,81,81,-1,-1,-1,-1,-1,79,80,-1,-1,81,81,81,-1,-1,81,81,81,-1,-1},
+    /* fator */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,88,89,90,91,92,-1,-1,-1,-1,-1,-1,-1,-1,87,86,-1,-1,-1,-1,-1},
+    /* produto */
+    {-1,-1,-1,-1,-1,-1,-1,-1,85,85,85,-1,85,85,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,85,85,83,84,85,85,85,-1,-1,85,85,85,-1,-1},
+    /* chamada_opt */
+    {-1,-1,-1,-1,-1,-1,-1,-1,94,94,94,-1,94,94,94,94,94,94,94,94,94,-1,-1,-1,-1,-1,94,94,94,94,94,94,94,-1,93,94,94,94,-1,-1},
+    /* argumentos */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,96,96,96,96,96,-1,-1,-1,-1,-1,-1,-1,-1,96,96,97,-1,-1,-1,-1},
+    /* mais_args */
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,99,98,-1,-1,-1},
+};
+
+/* Nome e terminais esperados de cada não-terminal (mensagens de erro) */
+static const struct { const char *nome; const char *esperados; } nao_terminais_ll1[NUM_NAO_TERMINAIS_LL1] = {
+    { "programa", "prg" },
+    { "secao_var", "var|subrot|int|float|char|void|begin|ID" },
+    { "subrotinas", "subrot|begin" },
+    { "corpo", "begin" },
+    { "bloco", "begin" },
+    { "decl_var", "int|float|char|void|ID" },
+    { "decls_var", "subrot|int|float|char|void|begin|ID" },
+    { "tipo", "int|float|char|void" },
+    { "vars_tipadas", ",|;" },
+    { "ids", ",|:" },
+    { "subrotina", "subrot" },
+    { "cabecalho", "int|float|char|void|ID" },
+    { "pv_opt", "var|subrot|int|float|char|void|begin|ID|;" },
+    { "parametros", "int|float|char|void|ID|)" },
+    { "retorno", "var|subrot|int|float|char|void|begin|ID|;|:" },
+    { "params_tipo", ")|," },
+    { "ids_param", ",|:" },
+    { "decls_locais", "int|float|char|void|read|write|if|for|while|repeat|begin|end|return|ID" },
+    { "comandos", "read|write|if|for|while|repeat|begin|end|return|ID" },
+    { "decl_local", "int|float|char|void" },
+    { "comando", "read|write|if|for|while|repeat|begin|return|ID" },
+    { "separador", "read|write|if|for|while|repeat|begin|end|return|ID|;" },
+    { "resto_id", "<-|(" },
+    { "cmd_read", "read" },
+    { "cmd_write", "write" },
+    { "cmd_return", "return" },
+    { "cmd_if", "if" },
+    { "cmd_while", "while" },
+    { "cmd_for", "for" },
+    { "cmd_repeat", "repeat" },
+    { "expressao", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "chamada", "(" },
+    { "senao", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|;" },
+    { "atrib_opt", "ID|)|;" },
+    { "lidos", ")|," },
+    { "item_write", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "itens_write", ")|," },
+    { "retorno_expr", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(|;" },
+    { "expr_rel", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "expr_log", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|and|or|)|,|;" },
+    { "expr_arit", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "rel_opt", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|OP_REL|and|or|)|,|;" },
+    { "termo", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "soma", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|+|-|OP_REL|and|or|)|,|;" },
+    { "fator", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(" },
+    { "produto", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|+|-|*|/|OP_REL|and|or|)|,|;" },
+    { "chamada_opt", "read|write|if|else|for|while|repeat|until|begin|end|return|ID|+|-|*|/|OP_REL|and|or|(|)|,|;" },
+    { "argumentos", "ID|LIT_INT|LIT_FLOAT|LIT_CHAR|LIT_STRING|not|(|)" },
+    { "mais_args", ")|," },
+};
+
+/* Conflitos LL(1) da gramática (fica a produção listada primeiro):
+conflito LL(1) em senao com 'else': senao -> else comando  x  senao -> ε
+conflito LL(1) em item_write com 'LIT_CHAR': item_write -> LIT_CHAR  x  item_write -> @linha expressao @escrito
+conflito LL(1) em item_write com 'LIT_STRING': item_write -> LIT_STRING  x  item_write -> @linha expressao @escrito
+conflito LL(1) em retorno_expr com 'ID': retorno_expr -> expressao @retorno_valor  x  retorno_expr -> @retorno_vazio
+*/
+
+#endif